@@ -22,118 +22,132 @@ std::unique_lock<BuiltinFunctionsLib::MutexType> BuiltinFunctionsLib::obtainUniq
 
 void BuiltinFunctionsLibImpl::initFunctions() {
     for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::COUNT); builtId++) {
-        const char *builtinName = nullptr;
-        NEO::EBuiltInOps::Type builtin;
-
-        switch (static_cast<Builtin>(builtId)) {
-        case Builtin::CopyBufferBytes:
-            builtinName = "copyBufferToBufferBytesSingle";
-            builtin = NEO::EBuiltInOps::CopyBufferToBuffer;
-            break;
-        case Builtin::CopyBufferRectBytes2d:
-            builtinName = "CopyBufferRectBytes2d";
-            builtin = NEO::EBuiltInOps::CopyBufferRect;
-            break;
-        case Builtin::CopyBufferRectBytes3d:
-            builtinName = "CopyBufferRectBytes3d";
-            builtin = NEO::EBuiltInOps::CopyBufferRect;
-            break;
-        case Builtin::CopyBufferToBufferMiddle:
-            builtinName = "CopyBufferToBufferMiddleRegion";
-            builtin = NEO::EBuiltInOps::CopyBufferToBuffer;
-            break;
-        case Builtin::CopyBufferToBufferSide:
-            builtinName = "CopyBufferToBufferSideRegion";
-            builtin = NEO::EBuiltInOps::CopyBufferToBuffer;
-            break;
-        case Builtin::CopyBufferToImage3d16Bytes:
-            builtinName = "CopyBufferToImage3d16Bytes";
-            builtin = NEO::EBuiltInOps::CopyBufferToImage3d;
-            break;
-        case Builtin::CopyBufferToImage3d2Bytes:
-            builtinName = "CopyBufferToImage3d2Bytes";
-            builtin = NEO::EBuiltInOps::CopyBufferToImage3d;
-            break;
-        case Builtin::CopyBufferToImage3d4Bytes:
-            builtinName = "CopyBufferToImage3d4Bytes";
-            builtin = NEO::EBuiltInOps::CopyBufferToImage3d;
-            break;
-        case Builtin::CopyBufferToImage3d8Bytes:
-            builtinName = "CopyBufferToImage3d8Bytes";
-            builtin = NEO::EBuiltInOps::CopyBufferToImage3d;
-            break;
-        case Builtin::CopyBufferToImage3dBytes:
-            builtinName = "CopyBufferToImage3dBytes";
-            builtin = NEO::EBuiltInOps::CopyBufferToImage3d;
-            break;
-        case Builtin::FillBufferImmediate:
-            builtinName = "FillBufferImmediate";
-            builtin = NEO::EBuiltInOps::FillBuffer;
-            break;
-        case Builtin::FillBufferSSHOffset:
-            builtinName = "FillBufferSSHOffset";
-            builtin = NEO::EBuiltInOps::FillBuffer;
-            break;
-        case Builtin::QueryKernelTimestamps:
-            builtinName = "QueryKernelTimestamps";
-            builtin = NEO::EBuiltInOps::QueryKernelTimestamps;
-            break;
-        case Builtin::QueryKernelTimestampsWithOffsets:
-            builtinName = "QueryKernelTimestampsWithOffsets";
-            builtin = NEO::EBuiltInOps::QueryKernelTimestamps;
-            break;
-        default:
-            continue;
-        };
-
-        builtins[builtId] = loadBuiltIn(builtin, builtinName);
+        initBuiltinKernel(static_cast<Builtin>(builtId));
     }
 }
 
+void BuiltinFunctionsLibImpl::initBuiltinKernel(Builtin func) {
+    const char *builtinName = nullptr;
+    NEO::EBuiltInOps::Type builtin;
+
+    switch (func) {
+    case Builtin::CopyBufferBytes:
+        builtinName = "copyBufferToBufferBytesSingle";
+        builtin = NEO::EBuiltInOps::CopyBufferToBuffer;
+        break;
+    case Builtin::CopyBufferRectBytes2d:
+        builtinName = "CopyBufferRectBytes2d";
+        builtin = NEO::EBuiltInOps::CopyBufferRect;
+        break;
+    case Builtin::CopyBufferRectBytes3d:
+        builtinName = "CopyBufferRectBytes3d";
+        builtin = NEO::EBuiltInOps::CopyBufferRect;
+        break;
+    case Builtin::CopyBufferToBufferMiddle:
+        builtinName = "CopyBufferToBufferMiddleRegion";
+        builtin = NEO::EBuiltInOps::CopyBufferToBuffer;
+        break;
+    case Builtin::CopyBufferToBufferSide:
+        builtinName = "CopyBufferToBufferSideRegion";
+        builtin = NEO::EBuiltInOps::CopyBufferToBuffer;
+        break;
+    case Builtin::CopyBufferToImage3d16Bytes:
+        builtinName = "CopyBufferToImage3d16Bytes";
+        builtin = NEO::EBuiltInOps::CopyBufferToImage3d;
+        break;
+    case Builtin::CopyBufferToImage3d2Bytes:
+        builtinName = "CopyBufferToImage3d2Bytes";
+        builtin = NEO::EBuiltInOps::CopyBufferToImage3d;
+        break;
+    case Builtin::CopyBufferToImage3d4Bytes:
+        builtinName = "CopyBufferToImage3d4Bytes";
+        builtin = NEO::EBuiltInOps::CopyBufferToImage3d;
+        break;
+    case Builtin::CopyBufferToImage3d8Bytes:
+        builtinName = "CopyBufferToImage3d8Bytes";
+        builtin = NEO::EBuiltInOps::CopyBufferToImage3d;
+        break;
+    case Builtin::CopyBufferToImage3dBytes:
+        builtinName = "CopyBufferToImage3dBytes";
+        builtin = NEO::EBuiltInOps::CopyBufferToImage3d;
+        break;
+    case Builtin::FillBufferImmediate:
+        builtinName = "FillBufferImmediate";
+        builtin = NEO::EBuiltInOps::FillBuffer;
+        break;
+    case Builtin::FillBufferSSHOffset:
+        builtinName = "FillBufferSSHOffset";
+        builtin = NEO::EBuiltInOps::FillBuffer;
+        break;
+    case Builtin::QueryKernelTimestamps:
+        builtinName = "QueryKernelTimestamps";
+        builtin = NEO::EBuiltInOps::QueryKernelTimestamps;
+        break;
+    case Builtin::QueryKernelTimestampsWithOffsets:
+        builtinName = "QueryKernelTimestampsWithOffsets";
+        builtin = NEO::EBuiltInOps::QueryKernelTimestamps;
+        break;
+    default:
+        return;
+    };
+
+    builtins[static_cast<uint32_t>(func)] = loadBuiltIn(builtin, builtinName);
+}
+
 void BuiltinFunctionsLibImpl::initImageFunctions() {
     for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(ImageBuiltin::COUNT); builtId++) {
-        const char *builtinName = nullptr;
-        NEO::EBuiltInOps::Type builtin;
-
-        switch (static_cast<ImageBuiltin>(builtId)) {
-        case ImageBuiltin::CopyImage3dToBuffer16Bytes:
-            builtinName = "CopyImage3dToBuffer16Bytes";
-            builtin = NEO::EBuiltInOps::CopyImage3dToBuffer;
-            break;
-        case ImageBuiltin::CopyImage3dToBuffer2Bytes:
-            builtinName = "CopyImage3dToBuffer2Bytes";
-            builtin = NEO::EBuiltInOps::CopyImage3dToBuffer;
-            break;
-        case ImageBuiltin::CopyImage3dToBuffer4Bytes:
-            builtinName = "CopyImage3dToBuffer4Bytes";
-            builtin = NEO::EBuiltInOps::CopyImage3dToBuffer;
-            break;
-        case ImageBuiltin::CopyImage3dToBuffer8Bytes:
-            builtinName = "CopyImage3dToBuffer8Bytes";
-            builtin = NEO::EBuiltInOps::CopyImage3dToBuffer;
-            break;
-        case ImageBuiltin::CopyImage3dToBufferBytes:
-            builtinName = "CopyImage3dToBufferBytes";
-            builtin = NEO::EBuiltInOps::CopyImage3dToBuffer;
-            break;
-        case ImageBuiltin::CopyImageRegion:
-            builtinName = "CopyImageToImage3d";
-            builtin = NEO::EBuiltInOps::CopyImageToImage3d;
-            break;
-        default:
-            continue;
-        };
-
-        imageBuiltins[builtId] = loadBuiltIn(builtin, builtinName);
+        initBuiltinImageKernel(static_cast<ImageBuiltin>(builtId));
     }
 }
 
+void BuiltinFunctionsLibImpl::initBuiltinImageKernel(ImageBuiltin func) {
+    const char *builtinName = nullptr;
+    NEO::EBuiltInOps::Type builtin;
+
+    switch (func) {
+    case ImageBuiltin::CopyImage3dToBuffer16Bytes:
+        builtinName = "CopyImage3dToBuffer16Bytes";
+        builtin = NEO::EBuiltInOps::CopyImage3dToBuffer;
+        break;
+    case ImageBuiltin::CopyImage3dToBuffer2Bytes:
+        builtinName = "CopyImage3dToBuffer2Bytes";
+        builtin = NEO::EBuiltInOps::CopyImage3dToBuffer;
+        break;
+    case ImageBuiltin::CopyImage3dToBuffer4Bytes:
+        builtinName = "CopyImage3dToBuffer4Bytes";
+        builtin = NEO::EBuiltInOps::CopyImage3dToBuffer;
+        break;
+    case ImageBuiltin::CopyImage3dToBuffer8Bytes:
+        builtinName = "CopyImage3dToBuffer8Bytes";
+        builtin = NEO::EBuiltInOps::CopyImage3dToBuffer;
+        break;
+    case ImageBuiltin::CopyImage3dToBufferBytes:
+        builtinName = "CopyImage3dToBufferBytes";
+        builtin = NEO::EBuiltInOps::CopyImage3dToBuffer;
+        break;
+    case ImageBuiltin::CopyImageRegion:
+        builtinName = "CopyImageToImage3d";
+        builtin = NEO::EBuiltInOps::CopyImageToImage3d;
+        break;
+    default:
+        return;
+    };
+
+    imageBuiltins[static_cast<uint32_t>(func)] = loadBuiltIn(builtin, builtinName);
+}
+
 Kernel *BuiltinFunctionsLibImpl::getFunction(Builtin func) {
     auto builtId = static_cast<uint32_t>(func);
+    if (builtins[builtId].get() == nullptr) {
+        initBuiltinKernel(func);
+    }
     return builtins[builtId]->func.get();
 }
 Kernel *BuiltinFunctionsLibImpl::getImageFunction(ImageBuiltin func) {
     auto builtId = static_cast<uint32_t>(func);
+    if (imageBuiltins[builtId].get() == nullptr) {
+        initBuiltinImageKernel(func);
+    }
     return imageBuiltins[builtId]->func.get();
 }
 
@@ -142,6 +156,9 @@ void BuiltinFunctionsLibImpl::initPageFaultFunction() {
 }
 
 Kernel *BuiltinFunctionsLibImpl::getPageFaultFunction() {
+    if (pageFaultBuiltin.get() == nullptr) {
+        initPageFaultFunction();
+    }
     return pageFaultBuiltin->func.get();
 }
 
@@ -39,6 +39,9 @@ struct BuiltinFunctionsLibImpl : BuiltinFunctionsLib {
     std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> loadBuiltIn(NEO::EBuiltInOps::Type builtin, const char *builtInName);
 
   protected:
+    void initBuiltinKernel(Builtin func);
+    void initBuiltinImageKernel(ImageBuiltin func);
+
     std::unique_ptr<BuiltinData> builtins[static_cast<uint32_t>(Builtin::COUNT)];
     std::unique_ptr<BuiltinData> imageBuiltins[static_cast<uint32_t>(ImageBuiltin::COUNT)];
     std::unique_ptr<BuiltinData> pageFaultBuiltin;
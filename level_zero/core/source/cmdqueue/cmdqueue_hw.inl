@@ -14,6 +14,7 @@
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/command_stream/thread_arbitration_policy.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/hw_info.h"
@@ -97,7 +98,17 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
         statePreemption = devicePreemption;
     }
 
-    threadArbitrationCmdSize = NEO::PreambleHelper<GfxFamily>::getThreadArbitrationCommandsSize();
+    stateCommandsStatistics = {};
+
+    auto &hwHelper = NEO::HwHelper::get(neoDevice->getHardwareInfo().platform.eRenderCoreFamily);
+    uint32_t threadArbitrationPolicy = hwHelper.getDefaultThreadArbitrationPolicy();
+    if (NEO::DebugManager.flags.OverrideThreadArbitrationPolicy.get() != -1) {
+        threadArbitrationPolicy = static_cast<uint32_t>(NEO::DebugManager.flags.OverrideThreadArbitrationPolicy.get());
+    }
+    bool threadArbitrationPolicyDirty = csr->peekLastSentThreadArbitrationPolicy() != threadArbitrationPolicy;
+    if (threadArbitrationPolicyDirty) {
+        threadArbitrationCmdSize = NEO::PreambleHelper<GfxFamily>::getThreadArbitrationCommandsSize();
+    }
 
     if (!commandQueueDebugCmdsProgrammed) {
         debuggerCmdsSize += NEO::PreambleHelper<GfxFamily>::getKernelDebuggingCommandsSize(neoDevice->isDebuggerActive());
@@ -205,6 +216,9 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     if (!isCopyOnlyCommandQueue) {
         if (!gpgpuEnabled) {
             programPipelineSelect(child);
+            stateCommandsStatistics.emitted++;
+        } else {
+            stateCommandsStatistics.elided++;
         }
 
         if (!commandQueueDebugCmdsProgrammed && neoDevice->isDebuggerActive()) {
@@ -214,10 +228,16 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
 
         if (frontEndStateDirty) {
             programFrontEnd(scratchSpaceController->getScratchPatchAddress(), child);
+            stateCommandsStatistics.emitted++;
+        } else {
+            stateCommandsStatistics.elided++;
         }
         if (gsbaStateDirty) {
             auto indirectHeap = CommandList::fromHandle(phCommandLists[0])->commandContainer.getIndirectHeap(NEO::HeapType::INDIRECT_OBJECT);
             programGeneralStateBaseAddress(scratchSpaceController->calculateNewGSH(), indirectHeap->getGraphicsAllocation()->isAllocatedInLocalMemoryPool(), child);
+            stateCommandsStatistics.emitted++;
+        } else {
+            stateCommandsStatistics.elided++;
         }
 
         if (commandQueuePreemptionMode == NEO::PreemptionMode::Initial) {
@@ -231,14 +251,15 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
             statePreemption = commandQueuePreemptionMode;
         }
 
-        auto &hwHelper = NEO::HwHelper::get(neoDevice->getHardwareInfo().platform.eRenderCoreFamily);
-        uint32_t threadArbitrationPolicy = hwHelper.getDefaultThreadArbitrationPolicy();
-        if (NEO::DebugManager.flags.OverrideThreadArbitrationPolicy.get() != -1) {
-            threadArbitrationPolicy = static_cast<uint32_t>(NEO::DebugManager.flags.OverrideThreadArbitrationPolicy.get());
+        // thread arbitration is tracked by the CSR, so queues sharing it program the policy only when it changes
+        if (threadArbitrationPolicyDirty) {
+            NEO::PreambleHelper<GfxFamily>::programThreadArbitration(&child, threadArbitrationPolicy);
+            csr->setLastSentThreadArbitrationPolicy(threadArbitrationPolicy);
+            stateCommandsStatistics.emitted++;
+        } else {
+            stateCommandsStatistics.elided++;
         }
 
-        NEO::PreambleHelper<GfxFamily>::programThreadArbitration(&child, threadArbitrationPolicy);
-
         const bool sipKernelUsed = devicePreemption == NEO::PreemptionMode::MidThread ||
                                    neoDevice->isDebuggerActive();
         if (devicePreemption == NEO::PreemptionMode::MidThread) {
@@ -269,6 +290,9 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
                                                                statePreemption,
                                                                csr->getPreemptionAllocation());
             statePreemption = commandListPreemption;
+            stateCommandsStatistics.emitted++;
+        } else if (!isCopyOnlyCommandQueue) {
+            stateCommandsStatistics.elided++;
         }
 
         for (size_t iter = 0; iter < cmdBufferCount; iter++) {
@@ -343,6 +367,10 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
 
     this->taskCount = csr->peekTaskCount();
 
+    NEO::printDebugString(NEO::DebugManager.flags.PrintStateCommandsStatistics.get(), stdout,
+                          "Submission with task count %u: state commands emitted: %u, elided: %u\n",
+                          this->taskCount, stateCommandsStatistics.emitted, stateCommandsStatistics.elided);
+
     csr->makeSurfacePackNonResident(residencyContainer);
 
     if (getSynchronousMode() == ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS) {
@@ -80,6 +80,13 @@ struct CommandQueueImp : public CommandQueue {
     ze_command_queue_mode_t getSynchronousMode();
     virtual void dispatchTaskCountWrite(NEO::LinearStream &commandStream, bool flushDataCache) = 0;
 
+    struct StateCommandsStatistics {
+        uint32_t emitted = 0u;
+        uint32_t elided = 0u;
+    };
+
+    const StateCommandsStatistics &getStateCommandsStatistics() const { return stateCommandsStatistics; }
+
   protected:
     MOCKABLE_VIRTUAL void submitBatchBuffer(size_t offset, NEO::ResidencyContainer &residencyContainer, void *endingCmdPtr);
 
@@ -96,6 +103,7 @@ struct CommandQueueImp : public CommandQueue {
     bool gsbaInit = false;
     bool frontEndInit = false;
     bool gpgpuEnabled = false;
+    StateCommandsStatistics stateCommandsStatistics;
     CommandBufferManager buffers;
 };
 
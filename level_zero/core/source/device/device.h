@@ -22,6 +22,7 @@
 struct _ze_device_handle_t {};
 namespace NEO {
 class Device;
+class LocalIdsCache;
 class MemoryManager;
 class SourceLevelDebugger;
 struct DeviceInfo;
@@ -88,6 +89,7 @@ struct Device : _ze_device_handle_t {
     virtual NEO::OSInterface &getOsInterface() = 0;
     virtual uint32_t getPlatformInfo() const = 0;
     virtual MetricContext &getMetricContext() = 0;
+    virtual NEO::LocalIdsCache &getLocalIdsCache() = 0;
 
     virtual ze_result_t activateMetricGroups(uint32_t count,
                                              zet_metric_group_handle_t *phMetricGroups) = 0;
@@ -501,6 +501,8 @@ uint32_t DeviceImp::getPlatformInfo() const {
 
 MetricContext &DeviceImp::getMetricContext() { return *metricContext; }
 
+NEO::LocalIdsCache &DeviceImp::getLocalIdsCache() { return *localIdsCache; }
+
 void DeviceImp::activateMetricGroups() {
     if (metricContext != nullptr) {
         metricContext->activateMetricGroups();
@@ -550,6 +552,7 @@ Device *Device::create(DriverHandle *driverHandle, NEO::Device *neoDevice, uint3
 
     device->execEnvironment = (void *)neoDevice->getExecutionEnvironment();
     device->metricContext = MetricContext::create(*device);
+    device->localIdsCache = std::make_unique<NEO::LocalIdsCache>();
     device->builtins = BuiltinFunctionsLib::create(
         device, neoDevice->getBuiltIns());
     device->maxNumHwThreads = NEO::HwHelper::getMaxThreadsForVfe(neoDevice->getHardwareInfo());
@@ -591,14 +594,6 @@ Device *Device::create(DriverHandle *driverHandle, NEO::Device *neoDevice, uint3
         device->numSubDevices = static_cast<uint32_t>(device->subDevices.size());
     }
 
-    if (neoDevice->getCompilerInterface()) {
-        device->getBuiltinFunctionsLib()->initFunctions();
-        device->getBuiltinFunctionsLib()->initPageFaultFunction();
-        if (device->getHwInfo().capabilityTable.supportsImages) {
-            device->getBuiltinFunctionsLib()->initImageFunctions();
-        }
-    }
-
     auto supportDualStorageSharedMemory = neoDevice->getMemoryManager()->isLocalMemorySupported(device->neoDevice->getRootDeviceIndex());
     if (NEO::DebugManager.flags.AllocateSharedAllocationsWithCpuAndGpuStorage.get() != -1) {
         supportDualStorageSharedMemory = NEO::DebugManager.flags.AllocateSharedAllocationsWithCpuAndGpuStorage.get();
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "opencl/source/command_queue/local_ids_cache.h"
+
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
 #include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/source/device/device.h"
@@ -54,6 +56,7 @@ struct DeviceImp : public Device {
     NEO::OSInterface &getOsInterface() override;
     uint32_t getPlatformInfo() const override;
     MetricContext &getMetricContext() override;
+    NEO::LocalIdsCache &getLocalIdsCache() override;
     uint32_t getMaxNumHwThreads() const override;
     ze_result_t registerCLMemory(cl_context context, cl_mem mem, void **ptr) override;
     ze_result_t registerCLProgram(cl_context context, cl_program program,
@@ -86,6 +89,7 @@ struct DeviceImp : public Device {
     void *execEnvironment = nullptr;
     std::unique_ptr<BuiltinFunctionsLib> builtins = nullptr;
     std::unique_ptr<MetricContext> metricContext = nullptr;
+    std::unique_ptr<NEO::LocalIdsCache> localIdsCache = nullptr;
     uint32_t maxNumHwThreads = 0;
     uint32_t numSubDevices = 0;
     std::vector<Device *> subDevices;
@@ -35,14 +35,18 @@ struct KernelImmutableData {
 
     void initialize(NEO::KernelInfo *kernelInfo, NEO::MemoryManager &memoryManager, const NEO::Device *device,
                     uint32_t computeUnitsUsedForSratch,
-                    NEO::GraphicsAllocation *globalConstBuffer, NEO::GraphicsAllocation *globalVarBuffer);
+                    NEO::GraphicsAllocation *globalConstBuffer, NEO::GraphicsAllocation *globalVarBuffer,
+                    NEO::GraphicsAllocation *packedIsaAllocation, uint64_t isaOffsetInPackedAllocation);
 
     const std::vector<NEO::GraphicsAllocation *> &getResidencyContainer() const {
         return residencyContainer;
     }
 
     uint32_t getIsaSize() const;
-    NEO::GraphicsAllocation *getIsaGraphicsAllocation() const { return isaGraphicsAllocation.get(); }
+    NEO::GraphicsAllocation *getIsaGraphicsAllocation() const {
+        return packedIsaAllocation ? packedIsaAllocation : isaGraphicsAllocation.get();
+    }
+    uint64_t getIsaOffsetInAllocation() const { return isaOffsetInAllocation; }
 
     uint64_t getPrivateMemorySize() const;
     NEO::GraphicsAllocation *getPrivateMemoryGraphicsAllocation() const { return privateMemoryGraphicsAllocation.get(); }
@@ -56,6 +60,7 @@ struct KernelImmutableData {
     const uint8_t *getDynamicStateHeapTemplate() const { return dynamicStateHeapTemplate.get(); }
 
     const NEO::KernelDescriptor &getDescriptor() const { return *kernelDescriptor; }
+    void setDescriptor(NEO::KernelDescriptor *descriptor) { kernelDescriptor = descriptor; }
 
     Device *getDevice() { return this->device; }
 
@@ -63,6 +68,9 @@ struct KernelImmutableData {
     Device *device = nullptr;
     NEO::KernelDescriptor *kernelDescriptor = nullptr;
     std::unique_ptr<NEO::GraphicsAllocation> isaGraphicsAllocation = nullptr;
+    NEO::GraphicsAllocation *packedIsaAllocation = nullptr;
+    uint64_t isaOffsetInAllocation = 0;
+    uint32_t isaSize = 0;
     std::unique_ptr<NEO::GraphicsAllocation> privateMemoryGraphicsAllocation = nullptr;
 
     uint32_t crossThreadDataSize = 0;
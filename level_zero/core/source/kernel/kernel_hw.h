@@ -105,17 +105,9 @@ struct KernelHw : public KernelImp {
             cloned->dynamicStateHeapDataSize = this->dynamicStateHeapDataSize;
         }
 
-        if (this->perThreadDataForWholeThreadGroup != nullptr) {
-            alignedFree(cloned->perThreadDataForWholeThreadGroup);
-            cloned->perThreadDataForWholeThreadGroup = reinterpret_cast<uint8_t *>(alignedMalloc(perThreadDataSizeForWholeThreadGroupAllocated, 32));
-            memcpy_s(cloned->perThreadDataForWholeThreadGroup,
-                     this->perThreadDataSizeForWholeThreadGroupAllocated,
-                     this->perThreadDataForWholeThreadGroup,
-                     this->perThreadDataSizeForWholeThreadGroupAllocated);
-            cloned->perThreadDataSizeForWholeThreadGroupAllocated = this->perThreadDataSizeForWholeThreadGroupAllocated;
-            cloned->perThreadDataSizeForWholeThreadGroup = this->perThreadDataSizeForWholeThreadGroup;
-            cloned->perThreadDataSize = this->perThreadDataSize;
-        }
+        cloned->perThreadDataForWholeThreadGroup = this->perThreadDataForWholeThreadGroup;
+        cloned->perThreadDataSizeForWholeThreadGroup = this->perThreadDataSizeForWholeThreadGroup;
+        cloned->perThreadDataSize = this->perThreadDataSize;
 
         return ret;
     }
@@ -18,6 +18,7 @@
 #include "shared/source/utilities/arrayref.h"
 
 #include "opencl/source/command_queue/gpgpu_walker.h"
+#include "opencl/source/command_queue/local_ids_cache.h"
 #include "opencl/source/program/kernel_info.h"
 
 #include "level_zero/core/source/device/device.h"
@@ -96,19 +97,28 @@ inline void patchWithImplicitSurface(ArrayRef<uint8_t> crossThreadData, ArrayRef
 void KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, NEO::MemoryManager &memoryManager,
                                      const NEO::Device *device, uint32_t computeUnitsUsedForSratch,
                                      NEO::GraphicsAllocation *globalConstBuffer,
-                                     NEO::GraphicsAllocation *globalVarBuffer) {
+                                     NEO::GraphicsAllocation *globalVarBuffer,
+                                     NEO::GraphicsAllocation *packedIsaAllocation, uint64_t isaOffsetInPackedAllocation) {
     UNRECOVERABLE_IF(kernelInfo == nullptr);
     this->kernelDescriptor = &kernelInfo->kernelDescriptor;
 
     auto kernelIsaSize = kernelInfo->heapInfo.KernelHeapSize;
+    this->isaSize = kernelIsaSize;
 
-    auto allocation = memoryManager.allocateGraphicsMemoryWithProperties(
-        {device->getRootDeviceIndex(), kernelIsaSize, NEO::GraphicsAllocation::AllocationType::KERNEL_ISA, device->getDeviceBitfield()});
-    UNRECOVERABLE_IF(allocation == nullptr);
-    if (kernelInfo->heapInfo.pKernelHeap != nullptr) {
-        memoryManager.copyMemoryToAllocation(allocation, kernelInfo->heapInfo.pKernelHeap, kernelIsaSize);
+    if (packedIsaAllocation != nullptr) {
+        // ISA was already uploaded by module together with other kernels sharing the allocation
+        this->packedIsaAllocation = packedIsaAllocation;
+        this->isaOffsetInAllocation = isaOffsetInPackedAllocation;
+    } else {
+        auto allocation = memoryManager.allocateGraphicsMemoryWithProperties(
+            {device->getRootDeviceIndex(), kernelIsaSize, NEO::GraphicsAllocation::AllocationType::KERNEL_ISA, device->getDeviceBitfield()});
+        UNRECOVERABLE_IF(allocation == nullptr);
+        isaGraphicsAllocation.reset(allocation);
+
+        if (kernelInfo->heapInfo.pKernelHeap != nullptr) {
+            memoryManager.copyMemoryToAllocation(allocation, 0u, kernelInfo->heapInfo.pKernelHeap, kernelIsaSize);
+        }
     }
-    isaGraphicsAllocation.reset(allocation);
 
     this->crossThreadDataSize = this->kernelDescriptor->kernelAttributes.crossThreadDataSize;
 
@@ -181,7 +191,7 @@ void KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, NEO::MemoryMan
 }
 
 uint32_t KernelImmutableData::getIsaSize() const {
-    return static_cast<uint32_t>(isaGraphicsAllocation->getUnderlyingBufferSize());
+    return isaSize;
 }
 
 uint64_t KernelImmutableData::getPrivateMemorySize() const {
@@ -195,9 +205,6 @@ uint64_t KernelImmutableData::getPrivateMemorySize() const {
 KernelImp::KernelImp(Module *module) : module(module) {}
 
 KernelImp::~KernelImp() {
-    if (perThreadDataForWholeThreadGroup != nullptr) {
-        alignedFree(perThreadDataForWholeThreadGroup);
-    }
     if (printfBuffer != nullptr) {
         module->getDevice()->getDriverHandle()->getMemoryManager()->freeGraphicsMemory(printfBuffer);
     }
@@ -259,28 +266,15 @@ ze_result_t KernelImp::setGroupSize(uint32_t groupSizeX, uint32_t groupSizeY,
 
     if (kernelRequiresGenerationOfLocalIdsByRuntime) {
         auto grfSize = this->module->getDevice()->getHwInfo().capabilityTable.grfSize;
-        uint32_t perThreadDataSizeForWholeThreadGroupNeeded =
-            static_cast<uint32_t>(NEO::PerThreadDataHelper::getPerThreadDataSizeTotal(
-                simdSize, grfSize, numChannels, itemsInGroup));
-        if (perThreadDataSizeForWholeThreadGroupNeeded >
-            perThreadDataSizeForWholeThreadGroupAllocated) {
-            alignedFree(perThreadDataForWholeThreadGroup);
-            perThreadDataForWholeThreadGroup = static_cast<uint8_t *>(alignedMalloc(perThreadDataSizeForWholeThreadGroupNeeded, 32));
-            perThreadDataSizeForWholeThreadGroupAllocated = perThreadDataSizeForWholeThreadGroupNeeded;
-        }
-        perThreadDataSizeForWholeThreadGroup = perThreadDataSizeForWholeThreadGroupNeeded;
-
-        if (numChannels > 0) {
-            UNRECOVERABLE_IF(3 != numChannels);
-            NEO::generateLocalIDs(
-                perThreadDataForWholeThreadGroup,
-                static_cast<uint16_t>(simdSize),
-                std::array<uint16_t, 3>{{static_cast<uint16_t>(groupSizeX),
-                                         static_cast<uint16_t>(groupSizeY),
-                                         static_cast<uint16_t>(groupSizeZ)}},
-                std::array<uint8_t, 3>{{0, 1, 2}},
-                false, grfSize);
-        }
+        auto perThreadData = this->module->getDevice()->getLocalIdsCache().getPerThreadData(
+            static_cast<uint16_t>(simdSize), grfSize, numChannels,
+            std::array<uint16_t, 3>{{static_cast<uint16_t>(groupSizeX),
+                                     static_cast<uint16_t>(groupSizeY),
+                                     static_cast<uint16_t>(groupSizeZ)}},
+            std::array<uint8_t, 3>{{0, 1, 2}},
+            false);
+        perThreadDataForWholeThreadGroup = perThreadData.perThreadData;
+        perThreadDataSizeForWholeThreadGroup = perThreadData.perThreadDataSize;
 
         this->perThreadDataSize = perThreadDataSizeForWholeThreadGroup / numThreadsPerThreadGroup;
     }
@@ -748,4 +742,8 @@ NEO::GraphicsAllocation *KernelImp::getIsaAllocation() const {
     return getImmutableData()->getIsaGraphicsAllocation();
 }
 
+uint64_t KernelImp::getIsaOffsetInAllocation() const {
+    return getImmutableData()->getIsaOffsetInAllocation();
+}
+
 } // namespace L0
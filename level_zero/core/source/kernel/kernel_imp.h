@@ -76,7 +76,7 @@ struct KernelImp : Kernel {
 
     ze_result_t initialize(const ze_kernel_desc_t *desc);
 
-    const uint8_t *getPerThreadData() const override { return perThreadDataForWholeThreadGroup; }
+    const uint8_t *getPerThreadData() const override { return perThreadDataForWholeThreadGroup.get(); }
     uint32_t getPerThreadDataSizeForWholeThreadGroup() const override { return perThreadDataSizeForWholeThreadGroup; }
 
     uint32_t getPerThreadDataSize() const override { return perThreadDataSize; }
@@ -104,6 +104,7 @@ struct KernelImp : Kernel {
     }
     uint32_t getSlmTotalSize() const override;
     NEO::GraphicsAllocation *getIsaAllocation() const override;
+    uint64_t getIsaOffsetInAllocation() const override;
 
     uint32_t getRequiredWorkgroupOrder() const override { return requiredWorkgroupOrder; }
     bool requiresGenerationOfLocalIdsByRuntime() const override { return kernelRequiresGenerationOfLocalIdsByRuntime; }
@@ -139,8 +140,7 @@ struct KernelImp : Kernel {
     std::unique_ptr<uint8_t[]> dynamicStateHeapData = nullptr;
     uint32_t dynamicStateHeapDataSize = 0;
 
-    uint8_t *perThreadDataForWholeThreadGroup = nullptr;
-    uint32_t perThreadDataSizeForWholeThreadGroupAllocated = 0;
+    std::shared_ptr<const uint8_t> perThreadDataForWholeThreadGroup;
     uint32_t perThreadDataSizeForWholeThreadGroup = 0u;
     uint32_t perThreadDataSize = 0u;
 
@@ -13,6 +13,7 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/program/parallel_kernel_decoding.h"
 #include "shared/source/program/program_initialization.h"
 #include "shared/source/source_level_debugger/source_level_debugger.h"
 
@@ -292,6 +293,10 @@ ModuleImp::ModuleImp(Device *device, ModuleBuildLog *moduleBuildLog)
 
 ModuleImp::~ModuleImp() {
     kernelImmDatas.clear();
+    for (auto packedIsaAllocation : packedIsaAllocations) {
+        this->device->getDriverHandle()->getMemoryManager()->freeGraphicsMemory(packedIsaAllocation);
+    }
+    packedIsaAllocations.clear();
 }
 
 bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice) {
@@ -333,23 +338,95 @@ bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice)
         return false;
     }
 
-    kernelImmDatas.reserve(this->translationUnit->programInfo.kernelInfos.size());
-    for (auto &ki : this->translationUnit->programInfo.kernelInfos) {
+    auto &kernelInfos = this->translationUnit->programInfo.kernelInfos;
+    auto memoryManager = getDevice()->getDriverHandle()->getMemoryManager();
+
+    if (NEO::DebugManager.flags.EnablePackedKernelIsa.get() == 1) {
+        std::vector<size_t> isaSizes;
+        isaSizes.reserve(kernelInfos.size());
+        for (auto &ki : kernelInfos) {
+            isaSizes.push_back(ki->heapInfo.KernelHeapSize);
+        }
+        auto allocationSizes = NEO::KernelIsaPacking::packKernelsIsa(isaSizes, isaPlacements);
+        for (auto allocationSize : allocationSizes) {
+            auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(
+                {device->getRootDeviceIndex(), allocationSize, NEO::GraphicsAllocation::AllocationType::KERNEL_ISA, device->getNEODevice()->getDeviceBitfield()});
+            if (allocation == nullptr) {
+                return false;
+            }
+            packedIsaAllocations.push_back(allocation);
+        }
+    }
+
+    // Kernels patched by the linker need their ISA in place before linking
+    auto linkerInput = this->translationUnit->programInfo.linkerInput.get();
+    bool isaPatchedByLinker = (linkerInput != nullptr) &&
+                              (linkerInput->getTraits().requiresPatchingOfInstructionSegments || (linkerInput->getExportedFunctionsSegmentId() >= 0));
+    lazyKernelInitialization = (NEO::DebugManager.flags.EnableLazyKernelInitialization.get() == 1) && (false == isaPatchedByLinker);
+
+    kernelImmDatas.reserve(kernelInfos.size());
+    kernelImmDatasInitialized.reset(new std::once_flag[kernelInfos.size()]);
+    for (auto &ki : kernelInfos) {
         std::unique_ptr<KernelImmutableData> kernelImmData{new KernelImmutableData(this->device)};
-        kernelImmData->initialize(ki, *(getDevice()->getDriverHandle()->getMemoryManager()),
-                                  device->getNEODevice(),
-                                  device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
-                                  this->translationUnit->globalConstBuffer, this->translationUnit->globalVarBuffer);
+        kernelImmData->setDescriptor(&ki->kernelDescriptor);
         kernelImmDatas.push_back(std::move(kernelImmData));
     }
+    if (false == lazyKernelInitialization) {
+        auto threadsCount = NEO::ParallelKernelDecoding::getThreadsCount(kernelImmDatas.size());
+        NEO::parallelFor(kernelImmDatas.size(), threadsCount, [this](size_t kernelId) {
+            initializeKernelImmutableData(kernelId);
+        });
+    }
+    uploadPackedKernelsIsa();
     this->maxGroupSize = static_cast<uint32_t>(this->translationUnit->device->getNEODevice()->getDeviceInfo().maxWorkGroupSize);
 
     return this->linkBinary();
 }
 
+void ModuleImp::uploadPackedKernelsIsa() {
+    // Kernels sharing an allocation must not upload concurrently, so whole allocations are uploaded from one thread
+    auto &kernelInfos = this->translationUnit->programInfo.kernelInfos;
+    auto memoryManager = getDevice()->getDriverHandle()->getMemoryManager();
+
+    std::vector<uint8_t> packedIsa;
+    for (size_t allocationId = 0; allocationId < packedIsaAllocations.size(); allocationId++) {
+        auto allocation = packedIsaAllocations[allocationId];
+        packedIsa.assign(allocation->getUnderlyingBufferSize(), 0u);
+        for (size_t kernelId = 0; kernelId < kernelInfos.size(); kernelId++) {
+            auto &placement = isaPlacements[kernelId];
+            auto &heapInfo = kernelInfos[kernelId]->heapInfo;
+            if (placement.allocationId == allocationId && heapInfo.pKernelHeap != nullptr) {
+                memcpy_s(&packedIsa[placement.offset], packedIsa.size() - placement.offset, heapInfo.pKernelHeap, heapInfo.KernelHeapSize);
+            }
+        }
+        memoryManager->copyMemoryToAllocation(allocation, 0u, packedIsa.data(), packedIsa.size());
+    }
+}
+
+void ModuleImp::initializeKernelImmutableData(size_t kernelId) const {
+    std::call_once(kernelImmDatasInitialized[kernelId], [&]() {
+        NEO::GraphicsAllocation *packedIsaAllocation = nullptr;
+        uint64_t isaOffset = 0u;
+        if (false == isaPlacements.empty()) {
+            auto &placement = isaPlacements[kernelId];
+            packedIsaAllocation = packedIsaAllocations[placement.allocationId];
+            isaOffset = placement.offset;
+        }
+        kernelImmDatas[kernelId]->initialize(this->translationUnit->programInfo.kernelInfos[kernelId],
+                                             *(device->getDriverHandle()->getMemoryManager()),
+                                             device->getNEODevice(),
+                                             device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
+                                             this->translationUnit->globalConstBuffer, this->translationUnit->globalVarBuffer,
+                                             packedIsaAllocation, isaOffset);
+    });
+}
+
 const KernelImmutableData *ModuleImp::getKernelImmutableData(const char *functionName) const {
     for (auto &kernelImmData : kernelImmDatas) {
         if (kernelImmData->getDescriptor().kernelMetadata.kernelName.compare(functionName) == 0) {
+            if (lazyKernelInitialization) {
+                initializeKernelImmutableData(&kernelImmData - &kernelImmDatas[0]);
+            }
             return kernelImmData.get();
         }
     }
@@ -419,6 +496,7 @@ void ModuleImp::copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSeg
             }
             auto segmentId = &kernelImmData - &this->kernelImmDatas[0];
             this->device->getDriverHandle()->getMemoryManager()->copyMemoryToAllocation(kernelImmData->getIsaGraphicsAllocation(),
+                                                                                        static_cast<size_t>(kernelImmData->getIsaOffsetInAllocation()),
                                                                                         isaSegmentsForPatching[segmentId].hostPointer,
                                                                                         isaSegmentsForPatching[segmentId].segmentSize);
         }
@@ -447,9 +525,10 @@ bool ModuleImp::linkBinary() {
     }
     if (this->translationUnit->programInfo.linkerInput->getExportedFunctionsSegmentId() >= 0) {
         auto exportedFunctionHeapId = this->translationUnit->programInfo.linkerInput->getExportedFunctionsSegmentId();
-        this->exportedFunctionsSurface = this->kernelImmDatas[exportedFunctionHeapId]->getIsaGraphicsAllocation();
-        exportedFunctions.gpuAddress = static_cast<uintptr_t>(exportedFunctionsSurface->getGpuAddressToPatch());
-        exportedFunctions.segmentSize = exportedFunctionsSurface->getUnderlyingBufferSize();
+        auto &exportedFunctionsImmData = this->kernelImmDatas[exportedFunctionHeapId];
+        this->exportedFunctionsSurface = exportedFunctionsImmData->getIsaGraphicsAllocation();
+        exportedFunctions.gpuAddress = static_cast<uintptr_t>(exportedFunctionsSurface->getGpuAddressToPatch() + exportedFunctionsImmData->getIsaOffsetInAllocation());
+        exportedFunctions.segmentSize = exportedFunctionsImmData->getIsaSize();
     }
     Linker::PatchableSegments isaSegmentsForPatching;
     std::vector<std::vector<char>> patchedIsaTempStorage;
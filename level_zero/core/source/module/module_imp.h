@@ -9,6 +9,7 @@
 
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/linker.h"
+#include "shared/source/program/kernel_isa_packing.h"
 #include "shared/source/program/program_info.h"
 #include "shared/source/utilities/const_stringref.h"
 
@@ -18,6 +19,7 @@
 #include "igfxfmid.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace L0 {
@@ -111,6 +113,8 @@ struct ModuleImp : public Module {
 
   protected:
     void copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSegmentsForPatching);
+    void initializeKernelImmutableData(size_t kernelId) const;
+    void uploadPackedKernelsIsa();
     void verifyDebugCapabilities();
     Device *device = nullptr;
     PRODUCT_FAMILY productFamily{};
@@ -119,6 +123,11 @@ struct ModuleImp : public Module {
     NEO::GraphicsAllocation *exportedFunctionsSurface = nullptr;
     uint32_t maxGroupSize = 0U;
     std::vector<std::unique_ptr<KernelImmutableData>> kernelImmDatas;
+    std::vector<NEO::GraphicsAllocation *> packedIsaAllocations;
+    std::vector<NEO::KernelIsaPacking::IsaPlacement> isaPlacements;
+    // ISA upload and heap templates of a kernel are built on its first use
+    bool lazyKernelInitialization = false;
+    std::unique_ptr<std::once_flag[]> kernelImmDatasInitialized;
     NEO::Linker::RelocatedSymbolsMap symbols;
     bool debugEnabled = false;
     bool isFullyLinked = false;
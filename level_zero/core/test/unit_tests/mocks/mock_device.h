@@ -200,6 +200,10 @@ struct Mock<Device> : public Device {
                 getMetricContext,
                 (),
                 (override));
+    MOCK_METHOD(NEO::LocalIdsCache &,
+                getLocalIdsCache,
+                (),
+                (override));
     MOCK_METHOD(const NEO::HardwareInfo &,
                 getHwInfo,
                 (),
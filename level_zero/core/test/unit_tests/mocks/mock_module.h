@@ -23,8 +23,10 @@ struct WhiteBox<::L0::Module> : public ::L0::ModuleImp {
     using BaseClass = ::L0::ModuleImp;
     using BaseClass::BaseClass;
     using BaseClass::device;
+    using BaseClass::isaPlacements;
     using BaseClass::isFullyLinked;
     using BaseClass::kernelImmDatas;
+    using BaseClass::packedIsaAllocations;
     using BaseClass::symbols;
     using BaseClass::translationUnit;
     using BaseClass::unresolvedExternalsInfo;
@@ -65,6 +65,25 @@ HWTEST_F(TestBuiltinFunctionsLibImpl, givenInitFunctionWhenBultinsTableConstainN
     }
 }
 
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenNotLoadedBuiltinsWhenGettingFunctionThenOnlyRequestedBuiltinIsLoaded) {
+    auto requestedBuiltin = static_cast<uint32_t>(Builtin::FillBufferImmediate);
+    EXPECT_NE(nullptr, mockBuiltinFunctionsLibImpl->getFunction(Builtin::FillBufferImmediate));
+
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::COUNT); builtId++) {
+        if (builtId == requestedBuiltin) {
+            EXPECT_NE(nullptr, mockBuiltinFunctionsLibImpl->builtins[builtId]);
+        } else {
+            EXPECT_EQ(nullptr, mockBuiltinFunctionsLibImpl->builtins[builtId]);
+        }
+    }
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(ImageBuiltin::COUNT); builtId++) {
+        EXPECT_EQ(nullptr, mockBuiltinFunctionsLibImpl->imageBuiltins[builtId]);
+    }
+
+    auto kernel = mockBuiltinFunctionsLibImpl->getFunction(Builtin::FillBufferImmediate);
+    EXPECT_EQ(kernel, mockBuiltinFunctionsLibImpl->getFunction(Builtin::FillBufferImmediate));
+}
+
 HWTEST_F(TestBuiltinFunctionsLibImpl, givenCompilerInterfaceWhenCreateDeviceAndImageSupportedThenBuiltinsImageFunctionsAreLoaded) {
     neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[neoDevice->getRootDeviceIndex()]->compilerInterface.reset(new NEO::MockCompilerInterface());
     std::unique_ptr<L0::Device> testDevice(Device::create(device->getDriverHandle(), neoDevice, std::numeric_limits<uint32_t>::max(), false));
@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/state_base_address.h"
 #include "shared/source/os_interface/device_factory.h"
 #include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
@@ -202,6 +203,57 @@ HWTEST_F(CommandQueueCommands, givenCommandQueueWhenExecutingCommandListsThenHar
     commandQueue->destroy();
 }
 
+HWTEST_F(CommandQueueCommands, givenStateAlreadyProgrammedWhenExecutingCommandListsAgainThenStateCommandsAreElided) {
+    const ze_command_queue_desc_t desc = {};
+    auto csr = neoDevice->getDefaultEngine().commandStreamReceiver;
+
+    auto commandQueue = whitebox_cast(CommandQueue::create(productFamily, device, csr, &desc, false));
+    ASSERT_NE(nullptr, commandQueue);
+
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, false));
+    auto commandListHandle = commandList->toHandle();
+
+    auto status = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+    auto firstSubmission = commandQueue->getStateCommandsStatistics();
+    EXPECT_LT(0u, firstSubmission.emitted);
+
+    status = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+    auto secondSubmission = commandQueue->getStateCommandsStatistics();
+    EXPECT_EQ(0u, secondSubmission.emitted);
+    EXPECT_EQ(firstSubmission.emitted + firstSubmission.elided, secondSubmission.elided);
+
+    commandQueue->destroy();
+}
+
+HWTEST_F(CommandQueueCommands, givenThreadArbitrationPolicyProgrammedByOtherQueueOnSameCsrWhenExecutingCommandListsThenPolicyIsNotProgrammedAgain) {
+    const ze_command_queue_desc_t desc = {};
+    auto csr = neoDevice->getDefaultEngine().commandStreamReceiver;
+
+    auto commandQueue = whitebox_cast(CommandQueue::create(productFamily, device, csr, &desc, false));
+    auto otherCommandQueue = whitebox_cast(CommandQueue::create(productFamily, device, csr, &desc, false));
+    ASSERT_NE(nullptr, commandQueue);
+    ASSERT_NE(nullptr, otherCommandQueue);
+
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, false));
+    auto commandListHandle = commandList->toHandle();
+
+    auto status = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+    auto &hwHelper = NEO::HwHelper::get(neoDevice->getHardwareInfo().platform.eRenderCoreFamily);
+    EXPECT_EQ(hwHelper.getDefaultThreadArbitrationPolicy(), csr->peekLastSentThreadArbitrationPolicy());
+
+    status = otherCommandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+
+    EXPECT_EQ(commandQueue->getStateCommandsStatistics().emitted - 1, otherCommandQueue->getStateCommandsStatistics().emitted);
+    EXPECT_EQ(commandQueue->getStateCommandsStatistics().elided + 1, otherCommandQueue->getStateCommandsStatistics().elided);
+
+    otherCommandQueue->destroy();
+    commandQueue->destroy();
+}
+
 using CommandQueueIndirectAllocations = Test<ModuleFixture>;
 HWTEST_F(CommandQueueIndirectAllocations, givenCommandQueueWhenExecutingCommandListsThenExpectedIndirectAllocationsAddedToResidencyContainer) {
     const ze_command_queue_desc_t desc = {};
@@ -7,6 +7,7 @@
 
 #include "shared/test/unit_test/mocks/mock_device.h"
 
+#include "opencl/source/command_queue/local_ids_cache.h"
 #include "opencl/source/program/kernel_info.h"
 #include "test.h"
 
@@ -39,7 +40,7 @@ HWTEST_F(KernelImpSetGroupSizeTest, WhenCalculatingLocalIdsThenGrfSizeIsTakenFro
     ASSERT_LE(grfSize * groupSize[0] * groupSize[1] * groupSize[2], mockKernel.perThreadDataSizeForWholeThreadGroup);
     using LocalIdT = unsigned short;
     auto threadOffsetInLocalIds = grfSize / sizeof(LocalIdT);
-    auto generatedLocalIds = reinterpret_cast<LocalIdT *>(mockKernel.perThreadDataForWholeThreadGroup);
+    auto generatedLocalIds = reinterpret_cast<const LocalIdT *>(mockKernel.perThreadDataForWholeThreadGroup.get());
 
     uint32_t threadId = 0;
     for (uint32_t z = 0; z < groupSize[2]; ++z) {
@@ -67,7 +68,60 @@ HWTEST_F(KernelImpSetGroupSizeTest, givenLocalIdGenerationByRuntimeDisabledWhenS
     EXPECT_EQ(groupSize[0] * groupSize[1] * groupSize[2], mockKernel.numThreadsPerThreadGroup);
     EXPECT_EQ(0u, mockKernel.perThreadDataSizeForWholeThreadGroup);
     EXPECT_EQ(0u, mockKernel.perThreadDataSize);
-    EXPECT_EQ(nullptr, mockKernel.perThreadDataForWholeThreadGroup);
+    EXPECT_EQ(nullptr, mockKernel.perThreadDataForWholeThreadGroup.get());
+}
+
+HWTEST_F(KernelImpSetGroupSizeTest, givenKernelsWithSameGroupSizeWhenSettingGroupSizeThenLocalIdsAreSharedFromDeviceCache) {
+    Mock<Module> mockModule(this->device, nullptr);
+    Mock<Kernel> firstKernel;
+    Mock<Kernel> secondKernel;
+    firstKernel.descriptor.kernelAttributes.simdSize = 16;
+    firstKernel.descriptor.kernelAttributes.numLocalIdChannels = 3;
+    firstKernel.module = &mockModule;
+    secondKernel.descriptor.kernelAttributes.simdSize = 16;
+    secondKernel.descriptor.kernelAttributes.numLocalIdChannels = 3;
+    secondKernel.module = &mockModule;
+
+    auto &localIdsCache = device->getLocalIdsCache();
+    auto cachedEntries = localIdsCache.getCachedEntriesCount();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, firstKernel.setGroupSize(16, 4, 2));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, secondKernel.setGroupSize(16, 4, 2));
+    EXPECT_EQ(cachedEntries + 1, localIdsCache.getCachedEntriesCount());
+    ASSERT_NE(nullptr, firstKernel.perThreadDataForWholeThreadGroup.get());
+    EXPECT_EQ(firstKernel.perThreadDataForWholeThreadGroup.get(), secondKernel.perThreadDataForWholeThreadGroup.get());
+    EXPECT_EQ(firstKernel.perThreadDataSizeForWholeThreadGroup, secondKernel.perThreadDataSizeForWholeThreadGroup);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, secondKernel.setGroupSize(8, 8, 2));
+    EXPECT_EQ(cachedEntries + 2, localIdsCache.getCachedEntriesCount());
+    EXPECT_NE(firstKernel.perThreadDataForWholeThreadGroup.get(), secondKernel.perThreadDataForWholeThreadGroup.get());
+}
+
+HWTEST_F(KernelImpSetGroupSizeTest, givenLocalIdsCacheWithoutFreeEntriesWhenSettingGroupSizeThenKernelKeepsOwnLocalIds) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.LocalIdsCacheMaxEntries.set(0);
+    auto deviceImp = static_cast<DeviceImp *>(device);
+    deviceImp->localIdsCache = std::make_unique<NEO::LocalIdsCache>();
+
+    Mock<Module> mockModule(this->device, nullptr);
+    Mock<Kernel> firstKernel;
+    Mock<Kernel> secondKernel;
+    firstKernel.descriptor.kernelAttributes.simdSize = 16;
+    firstKernel.descriptor.kernelAttributes.numLocalIdChannels = 3;
+    firstKernel.module = &mockModule;
+    secondKernel.descriptor.kernelAttributes.simdSize = 16;
+    secondKernel.descriptor.kernelAttributes.numLocalIdChannels = 3;
+    secondKernel.module = &mockModule;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, firstKernel.setGroupSize(16, 4, 2));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, secondKernel.setGroupSize(16, 4, 2));
+    EXPECT_EQ(0u, device->getLocalIdsCache().getCachedEntriesCount());
+    ASSERT_NE(nullptr, firstKernel.perThreadDataForWholeThreadGroup.get());
+    ASSERT_NE(nullptr, secondKernel.perThreadDataForWholeThreadGroup.get());
+    EXPECT_NE(firstKernel.perThreadDataForWholeThreadGroup.get(), secondKernel.perThreadDataForWholeThreadGroup.get());
+    EXPECT_EQ(1, firstKernel.perThreadDataForWholeThreadGroup.use_count());
+    EXPECT_EQ(0, memcmp(firstKernel.perThreadDataForWholeThreadGroup.get(), secondKernel.perThreadDataForWholeThreadGroup.get(),
+                        firstKernel.perThreadDataSizeForWholeThreadGroup));
 }
 
 using SetKernelArg = Test<ModuleFixture>;
@@ -5,8 +5,10 @@
  *
  */
 
+#include "shared/source/program/kernel_isa_packing.h"
 #include "shared/test/unit_test/compiler_interface/linker_mock.h"
 #include "shared/test/unit_test/device_binary_format/zebin_tests.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "opencl/source/program/kernel_info.h"
 #include "test.h"
@@ -16,8 +18,11 @@
 #include "level_zero/core/source/module/module_imp.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
 #include "level_zero/core/test/unit_tests/fixtures/module_fixture.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_memory_manager.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_module.h"
 
+#include <thread>
+
 namespace L0 {
 namespace ult {
 
@@ -98,6 +103,214 @@ HWTEST_F(ModuleTest, givenKernelCreateWithIncorrectKernelNameReturnsFailure) {
     EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, res);
 }
 
+HWTEST_F(ModuleTest, givenPackedKernelIsaEnabledWhenModuleIsCreatedThenKernelsShareIsaAllocationAtAlignedOffsets) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnablePackedKernelIsa.set(1);
+    createModuleFromBinary();
+    ASSERT_NE(nullptr, module);
+
+    auto &kernelImmDatas = module->getKernelImmutableDataVector();
+    ASSERT_NE(0u, kernelImmDatas.size());
+    auto packedAllocation = kernelImmDatas[0]->getIsaGraphicsAllocation();
+    ASSERT_NE(nullptr, packedAllocation);
+    EXPECT_EQ(NEO::GraphicsAllocation::AllocationType::KERNEL_ISA, packedAllocation->getAllocationType());
+
+    auto &kernelInfos = static_cast<ModuleImp *>(module.get())->getTranslationUnit()->programInfo.kernelInfos;
+    for (size_t i = 0; i < kernelImmDatas.size(); i++) {
+        auto &kernelImmData = kernelImmDatas[i];
+        EXPECT_EQ(packedAllocation, kernelImmData->getIsaGraphicsAllocation());
+        EXPECT_EQ(0u, kernelImmData->getIsaOffsetInAllocation() % NEO::KernelIsaPacking::isaAlignment);
+        EXPECT_EQ(kernelInfos[i]->heapInfo.KernelHeapSize, kernelImmData->getIsaSize());
+        auto isaInAllocation = ptrOffset(packedAllocation->getUnderlyingBuffer(), static_cast<size_t>(kernelImmData->getIsaOffsetInAllocation()));
+        EXPECT_EQ(0, memcmp(isaInAllocation, kernelInfos[i]->heapInfo.pKernelHeap, kernelInfos[i]->heapInfo.KernelHeapSize));
+    }
+}
+
+HWTEST_F(ModuleTest, givenPackedKernelIsaAndParallelKernelDecodingEnabledWhenModuleIsCreatedThenKernelsShareUploadedPackedIsa) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnablePackedKernelIsa.set(1);
+    DebugManager.flags.EnableParallelKernelDecoding.set(1);
+    DebugManager.flags.ParallelKernelDecodingThreads.set(4);
+    createModuleFromBinary();
+    ASSERT_NE(nullptr, module);
+
+    auto whiteBoxModule = whitebox_cast(module.get());
+    auto &kernelInfos = whiteBoxModule->getTranslationUnit()->programInfo.kernelInfos;
+    ASSERT_EQ(kernelInfos.size(), whiteBoxModule->kernelImmDatas.size());
+    for (size_t i = 0; i < kernelInfos.size(); i++) {
+        auto &kernelImmData = whiteBoxModule->kernelImmDatas[i];
+        auto &placement = whiteBoxModule->isaPlacements[i];
+        EXPECT_EQ(whiteBoxModule->packedIsaAllocations[placement.allocationId], kernelImmData->getIsaGraphicsAllocation());
+        EXPECT_EQ(placement.offset, kernelImmData->getIsaOffsetInAllocation());
+
+        auto isaInAllocation = ptrOffset(kernelImmData->getIsaGraphicsAllocation()->getUnderlyingBuffer(), placement.offset);
+        EXPECT_EQ(0, memcmp(isaInAllocation, kernelInfos[i]->heapInfo.pKernelHeap, kernelInfos[i]->heapInfo.KernelHeapSize));
+    }
+}
+
+HWTEST_F(ModuleTest, givenPackedKernelIsaAndLazyKernelInitializationEnabledWhenModuleIsCreatedThenIsaOfAllKernelsIsUploadedBeforeFirstUse) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnablePackedKernelIsa.set(1);
+    DebugManager.flags.EnableLazyKernelInitialization.set(1);
+    createModuleFromBinary();
+    ASSERT_NE(nullptr, module);
+
+    auto whiteBoxModule = whitebox_cast(module.get());
+    auto &kernelInfos = whiteBoxModule->getTranslationUnit()->programInfo.kernelInfos;
+    ASSERT_NE(0u, whiteBoxModule->packedIsaAllocations.size());
+    ASSERT_EQ(kernelInfos.size(), whiteBoxModule->isaPlacements.size());
+    for (size_t i = 0; i < kernelInfos.size(); i++) {
+        EXPECT_EQ(nullptr, whiteBoxModule->kernelImmDatas[i]->getIsaGraphicsAllocation());
+
+        auto &placement = whiteBoxModule->isaPlacements[i];
+        auto packedAllocation = whiteBoxModule->packedIsaAllocations[placement.allocationId];
+        auto isaInAllocation = ptrOffset(packedAllocation->getUnderlyingBuffer(), placement.offset);
+        EXPECT_EQ(0, memcmp(isaInAllocation, kernelInfos[i]->heapInfo.pKernelHeap, kernelInfos[i]->heapInfo.KernelHeapSize));
+    }
+}
+
+HWTEST_F(ModuleTest, givenLazyKernelInitializationEnabledWhenModuleIsCreatedThenKernelIsaIsUploadedOnFirstKernelCreate) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLazyKernelInitialization.set(1);
+    createModuleFromBinary();
+    ASSERT_NE(nullptr, module);
+
+    auto &kernelImmDatas = module->getKernelImmutableDataVector();
+    ASSERT_NE(0u, kernelImmDatas.size());
+    for (auto &kernelImmData : kernelImmDatas) {
+        EXPECT_EQ(nullptr, kernelImmData->getIsaGraphicsAllocation());
+    }
+
+    uint32_t kernelsCount = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module->getKernelNames(&kernelsCount, nullptr));
+    EXPECT_EQ(kernelImmDatas.size(), kernelsCount);
+
+    ze_kernel_handle_t kernelHandle;
+    ze_kernel_desc_t kernelDesc = {};
+    kernelDesc.pKernelName = kernelName.c_str();
+    ze_result_t res = module->createKernel(&kernelDesc, &kernelHandle);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+
+    auto kernelImmData = Kernel::fromHandle(kernelHandle)->getImmutableData();
+    EXPECT_NE(nullptr, kernelImmData->getIsaGraphicsAllocation());
+    EXPECT_EQ(kernelImmData, module->getKernelImmutableData(kernelName.c_str()));
+    EXPECT_EQ(kernelImmData->getIsaGraphicsAllocation(), module->getKernelImmutableData(kernelName.c_str())->getIsaGraphicsAllocation());
+
+    Kernel::fromHandle(kernelHandle)->destroy();
+}
+
+HWTEST_F(ModuleTest, givenLazyKernelInitializationEnabledWhenKernelIsFirstUsedFromManyThreadsThenItIsInitializedOnce) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLazyKernelInitialization.set(1);
+    createModuleFromBinary();
+    ASSERT_NE(nullptr, module);
+
+    constexpr size_t numThreads = 8;
+    const KernelImmutableData *kernelImmDatas[numThreads] = {};
+    NEO::GraphicsAllocation *isaAllocations[numThreads] = {};
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numThreads; i++) {
+        threads.push_back(std::thread([&, i]() {
+            kernelImmDatas[i] = module->getKernelImmutableData(kernelName.c_str());
+            isaAllocations[i] = kernelImmDatas[i]->getIsaGraphicsAllocation();
+        }));
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_NE(nullptr, isaAllocations[0]);
+    for (size_t i = 1; i < numThreads; i++) {
+        EXPECT_EQ(kernelImmDatas[0], kernelImmDatas[i]);
+        EXPECT_EQ(isaAllocations[0], isaAllocations[i]);
+    }
+}
+
+struct CopyCountingMemoryManager : public MemoryManagerMock {
+    CopyCountingMemoryManager(NEO::ExecutionEnvironment &executionEnvironment) : MemoryManagerMock(executionEnvironment) {}
+
+    bool copyMemoryToAllocation(NEO::GraphicsAllocation *graphicsAllocation, size_t destinationOffset, const void *memoryToCopy, size_t sizeToCopy) override {
+        copyMemoryToAllocationCalled++;
+        return MemoryManagerMock::copyMemoryToAllocation(graphicsAllocation, destinationOffset, memoryToCopy, sizeToCopy);
+    }
+
+    uint32_t copyMemoryToAllocationCalled = 0u;
+};
+
+using ModuleLazyKernelInitializationTest = Test<DeviceFixture>;
+
+HWTEST_F(ModuleLazyKernelInitializationTest, givenModuleWithManyKernelsAndLazyKernelInitializationEnabledWhenModuleIsCreatedThenNoKernelIsInitializedUntilItIsRequested) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLazyKernelInitialization.set(1);
+
+    auto rootDeviceEnvironment = neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[0].get();
+    rootDeviceEnvironment->compilerInterface.reset(new MockCompilerInterface());
+
+    CopyCountingMemoryManager memoryManager(*neoDevice->getExecutionEnvironment());
+    auto driverMemoryManager = driverHandle->getMemoryManager();
+    driverHandle->setMemoryManager(&memoryManager);
+
+    constexpr size_t numKernels = 2000;
+    uint8_t kernelIsa[64] = {};
+    uint8_t kernelSsh[64] = {};
+    uint8_t kernelDsh[64] = {};
+    auto mockTranslationUnit = new MockModuleTranslationUnit(device);
+    for (size_t i = 0; i < numKernels; i++) {
+        auto kernelInfo = new NEO::KernelInfo();
+        kernelInfo->kernelDescriptor.kernelMetadata.kernelName = "kernel" + std::to_string(i);
+        kernelInfo->kernelDescriptor.kernelAttributes.simdSize = 8;
+        kernelInfo->kernelDescriptor.kernelAttributes.crossThreadDataSize = 64;
+        kernelInfo->heapInfo.pKernelHeap = kernelIsa;
+        kernelInfo->heapInfo.KernelHeapSize = sizeof(kernelIsa);
+        kernelInfo->heapInfo.pSsh = kernelSsh;
+        kernelInfo->heapInfo.SurfaceStateHeapSize = sizeof(kernelSsh);
+        kernelInfo->heapInfo.pDsh = kernelDsh;
+        kernelInfo->heapInfo.DynamicStateHeapSize = sizeof(kernelDsh);
+        mockTranslationUnit->programInfo.kernelInfos.push_back(kernelInfo);
+    }
+
+    uint8_t spirvData{};
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pInputModule = &spirvData;
+    moduleDesc.inputSize = sizeof(spirvData);
+
+    {
+        Module module(device, nullptr);
+        module.translationUnit.reset(mockTranslationUnit);
+        ASSERT_TRUE(module.initialize(&moduleDesc, neoDevice));
+
+        EXPECT_EQ(0u, memoryManager.copyMemoryToAllocationCalled);
+        ASSERT_EQ(numKernels, module.kernelImmDatas.size());
+        for (auto &kernelImmData : module.kernelImmDatas) {
+            EXPECT_EQ(nullptr, kernelImmData->getIsaGraphicsAllocation());
+            EXPECT_EQ(nullptr, kernelImmData->getCrossThreadDataTemplate());
+            EXPECT_EQ(nullptr, kernelImmData->getSurfaceStateHeapTemplate());
+            EXPECT_EQ(nullptr, kernelImmData->getDynamicStateHeapTemplate());
+        }
+
+        auto requestedKernelImmData = module.getKernelImmutableData("kernel1000");
+        ASSERT_NE(nullptr, requestedKernelImmData);
+        EXPECT_EQ(1u, memoryManager.copyMemoryToAllocationCalled);
+        EXPECT_NE(nullptr, requestedKernelImmData->getIsaGraphicsAllocation());
+        EXPECT_NE(nullptr, requestedKernelImmData->getCrossThreadDataTemplate());
+        EXPECT_NE(nullptr, requestedKernelImmData->getSurfaceStateHeapTemplate());
+        EXPECT_NE(nullptr, requestedKernelImmData->getDynamicStateHeapTemplate());
+
+        for (auto &kernelImmData : module.kernelImmDatas) {
+            if (kernelImmData.get() != requestedKernelImmData) {
+                EXPECT_EQ(nullptr, kernelImmData->getIsaGraphicsAllocation());
+                EXPECT_EQ(nullptr, kernelImmData->getCrossThreadDataTemplate());
+            }
+        }
+
+        EXPECT_EQ(requestedKernelImmData, module.getKernelImmutableData("kernel1000"));
+        EXPECT_EQ(1u, memoryManager.copyMemoryToAllocationCalled);
+    }
+
+    driverHandle->setMemoryManager(driverMemoryManager);
+}
+
 struct ModuleSpecConstantsTests : public DeviceFixture,
                                   public ::testing::Test {
     void SetUp() override {
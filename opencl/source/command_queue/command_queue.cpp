@@ -89,6 +89,10 @@ CommandQueue::~CommandQueue() {
     }
 
     if (device) {
+        if (this->adaptiveBatchedDispatch) {
+            gpgpuEngine->commandStreamReceiver->disableAdaptiveBatchedDispatch();
+        }
+
         auto storageForAllocation = gpgpuEngine->commandStreamReceiver->getInternalAllocationStorage();
 
         if (commandStream) {
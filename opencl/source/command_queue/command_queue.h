@@ -362,6 +362,7 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     bool isSpecialCommandQueue = false;
     bool requiresCacheFlushAfterWalker = false;
+    bool adaptiveBatchedDispatch = false;
 
     std::unique_ptr<TimestampPacketContainer> timestampPacketContainer;
 };
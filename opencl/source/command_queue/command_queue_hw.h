@@ -69,6 +69,9 @@ class CommandQueueHw : public CommandQueue {
                 getGpgpuCommandStreamReceiver().overrideDispatchPolicy(static_cast<DispatchMode>(DebugManager.flags.CsrDispatchMode.get()));
             }
             getGpgpuCommandStreamReceiver().enableNTo1SubmissionModel();
+        } else if (!internalUsage && DebugManager.flags.EnableAdaptiveBatchedDispatch.get() == 1 && DebugManager.flags.CsrDispatchMode.get() == 0) {
+            getGpgpuCommandStreamReceiver().enableAdaptiveBatchedDispatch();
+            adaptiveBatchedDispatch = true;
         }
 
         if (device->getDevice().getDebugger()) {
@@ -8,6 +8,8 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/get_info.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/utilities/cpu_copy_engine.h"
 
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/context/context.h"
@@ -18,6 +20,14 @@
 #include "opencl/source/mem_obj/image.h"
 
 namespace NEO {
+static void copyOnCpu(CpuCopyEngine *cpuCopyEngine, void *dst, const void *src, size_t size) {
+    if (cpuCopyEngine) {
+        cpuCopyEngine->copy(dst, src, size);
+        return;
+    }
+    memcpy_s(dst, size, src, size);
+}
+
 void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &retVal) {
     MapInfo unmapInfo;
     Event *outEventObj = nullptr;
@@ -129,11 +139,11 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
             }
             break;
         case CL_COMMAND_READ_BUFFER:
-            memcpy_s(transferProperties.ptr, transferProperties.size[0], transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
+            copyOnCpu(getDevice().getMemoryManager()->getCpuCopyEngine(), transferProperties.ptr, transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
             eventCompleted = true;
             break;
         case CL_COMMAND_WRITE_BUFFER:
-            memcpy_s(transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], transferProperties.ptr, transferProperties.size[0]);
+            copyOnCpu(getDevice().getMemoryManager()->getCpuCopyEngine(), transferProperties.getCpuPtrForReadWrite(), transferProperties.ptr, transferProperties.size[0]);
             eventCompleted = true;
             modifySimulationFlags = true;
             break;
@@ -755,6 +755,12 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueNonBlocked(
     dispatchFlags.pipelineSelectArgs.mediaSamplerRequired = mediaSamplerRequired;
     dispatchFlags.pipelineSelectArgs.specialPipelineSelectMode = specialPipelineSelectMode;
 
+    dispatchFlags.adaptiveBatchedDispatch = this->adaptiveBatchedDispatch;
+    if (eventBuilder.getEvent() && this->adaptiveBatchedDispatch) {
+        // event makes this task visible to host, it can't wait in batch for next enqueues
+        dispatchFlags.implicitFlush = true;
+    }
+
     if (getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
         eventsRequest.fillCsrDependencies(dispatchFlags.csrDependencies, getGpgpuCommandStreamReceiver(), CsrDependencies::DependenciesType::OutOfCsr);
         dispatchFlags.csrDependencies.makeResident(getGpgpuCommandStreamReceiver());
@@ -964,6 +970,11 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueCommandWithoutKernel(
             false                                                                //usePerDssBackedBuffer
         );
 
+        dispatchFlags.adaptiveBatchedDispatch = this->adaptiveBatchedDispatch;
+        if (eventBuilder.getEvent() && this->adaptiveBatchedDispatch) {
+            dispatchFlags.implicitFlush = true;
+        }
+
         if (getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
             eventsRequest.fillCsrDependencies(dispatchFlags.csrDependencies, getGpgpuCommandStreamReceiver(), CsrDependencies::DependenciesType::OutOfCsr);
             dispatchFlags.csrDependencies.makeResident(getGpgpuCommandStreamReceiver());
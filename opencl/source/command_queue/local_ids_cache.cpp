@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/command_queue/local_ids_cache.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/debug_helpers.h"
+
+#include "opencl/source/command_queue/local_id_gen.h"
+
+#include <cstring>
+
+namespace NEO {
+
+constexpr size_t LocalIdsCache::defaultMaxCachedEntries;
+
+LocalIdsCache::LocalIdsCache() {
+    if (DebugManager.flags.LocalIdsCacheMaxEntries.get() != -1) {
+        maxCachedEntries = static_cast<size_t>(DebugManager.flags.LocalIdsCacheMaxEntries.get());
+    }
+}
+
+LocalIdsCacheEntry LocalIdsCache::getPerThreadData(uint16_t simd, uint32_t grfSize, uint32_t numChannels, const std::array<uint16_t, 3> &localWorkgroupSize,
+                                                   const std::array<uint8_t, 3> &dimensionsOrder, bool isImageOnlyKernel) {
+    Key key{simd, grfSize, numChannels, localWorkgroupSize, dimensionsOrder, isImageOnlyKernel};
+
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = cachedEntries.find(key);
+    if (it != cachedEntries.end()) {
+        return it->second;
+    }
+
+    auto itemsInGroup = localWorkgroupSize[0] * localWorkgroupSize[1] * localWorkgroupSize[2];
+    auto perThreadDataSize = static_cast<uint32_t>(getThreadsPerWG(simd, itemsInGroup) * getPerThreadSizeLocalIDs(simd, grfSize, numChannels));
+    auto perThreadData = static_cast<uint8_t *>(alignedMalloc(perThreadDataSize, 64));
+    UNRECOVERABLE_IF(perThreadData == nullptr);
+
+    if (numChannels > 0) {
+        UNRECOVERABLE_IF(3 != numChannels);
+        generateLocalIDs(perThreadData, simd, localWorkgroupSize, dimensionsOrder, isImageOnlyKernel, grfSize);
+    } else {
+        memset(perThreadData, 0, perThreadDataSize);
+    }
+
+    LocalIdsCacheEntry entry;
+    entry.perThreadData.reset(perThreadData, [](const uint8_t *ptr) { alignedFree(const_cast<uint8_t *>(ptr)); });
+    entry.perThreadDataSize = perThreadDataSize;
+
+    if (cachedEntries.size() >= maxCachedEntries) {
+        evictUnreferencedEntries();
+    }
+    if (cachedEntries.size() < maxCachedEntries) {
+        cachedEntries.insert({key, entry});
+    }
+    return entry;
+}
+
+void LocalIdsCache::evictUnreferencedEntries() {
+    // new references are handed out only under the lock, so a block held by the cache alone can be released
+    for (auto it = cachedEntries.begin(); it != cachedEntries.end();) {
+        if (it->second.perThreadData.use_count() == 1) {
+            it = cachedEntries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+size_t LocalIdsCache::getCachedEntriesCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return cachedEntries.size();
+}
+
+} // namespace NEO
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
+namespace NEO {
+
+struct LocalIdsCacheEntry {
+    std::shared_ptr<const uint8_t> perThreadData;
+    uint32_t perThreadDataSize = 0u;
+};
+
+// Per thread data blocks generated for a whole thread group, shared by all kernels of a device.
+// Blocks are immutable and stay alive as long as any kernel references them. When the cache is full,
+// blocks no longer referenced by kernels are evicted; if all of them are in use, the new block is
+// returned to the caller without being cached.
+class LocalIdsCache : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t defaultMaxCachedEntries = 256u;
+
+    LocalIdsCache();
+
+    LocalIdsCacheEntry getPerThreadData(uint16_t simd, uint32_t grfSize, uint32_t numChannels, const std::array<uint16_t, 3> &localWorkgroupSize,
+                                        const std::array<uint8_t, 3> &dimensionsOrder, bool isImageOnlyKernel);
+
+    size_t getCachedEntriesCount() const;
+
+  protected:
+    using Key = std::tuple<uint16_t, uint32_t, uint32_t, std::array<uint16_t, 3>, std::array<uint8_t, 3>, bool>;
+
+    void evictUnreferencedEntries();
+
+    std::map<Key, LocalIdsCacheEntry> cachedEntries;
+    size_t maxCachedEntries = defaultMaxCachedEntries;
+    mutable std::mutex mtx;
+};
+} // namespace NEO
@@ -303,23 +303,39 @@ size_t HardwareCommandsHelper<GfxFamily>::sendIndirectState(
 
     uint32_t sizeCrossThreadData = kernel.getCrossThreadDataSize();
 
-    size_t offsetCrossThreadData = HardwareCommandsHelper<GfxFamily>::sendCrossThreadData(
-        ioh, kernel, inlineDataProgrammingRequired,
-        walkerCmd, sizeCrossThreadData);
-
+    size_t offsetCrossThreadData = 0;
     size_t sizePerThreadDataTotal = 0;
     size_t sizePerThreadData = 0;
 
-    HardwareCommandsHelper<GfxFamily>::programPerThreadData(
-        sizePerThreadData,
-        localIdsGenerationByRuntime,
-        ioh,
-        simd,
-        numChannels,
-        localWorkSize,
-        kernel,
-        sizePerThreadDataTotal,
-        localWorkItems);
+    bool indirectDataReuseAllowed = DebugManager.flags.EnableIndirectDataReuse.get() == 1 &&
+                                    !inlineDataProgrammingRequired &&
+                                    !kernel.isParentKernel && !kernel.isSchedulerKernel &&
+                                    ioh.getGraphicsAllocation() != nullptr &&
+                                    !DebugManager.flags.AddPatchInfoCommentsForAUBDump.get();
+
+    if (indirectDataReuseAllowed && kernel.getReusableIndirectData(ioh, localWorkSize, offsetCrossThreadData)) {
+        // Indirect data of previous dispatch is identical and still in heap, walker can point to it
+        updatePerThreadDataTotal(sizePerThreadData, simd, numChannels, sizePerThreadDataTotal, localWorkItems);
+    } else {
+        offsetCrossThreadData = HardwareCommandsHelper<GfxFamily>::sendCrossThreadData(
+            ioh, kernel, inlineDataProgrammingRequired,
+            walkerCmd, sizeCrossThreadData);
+
+        HardwareCommandsHelper<GfxFamily>::programPerThreadData(
+            sizePerThreadData,
+            localIdsGenerationByRuntime,
+            ioh,
+            simd,
+            numChannels,
+            localWorkSize,
+            kernel,
+            sizePerThreadDataTotal,
+            localWorkItems);
+
+        if (indirectDataReuseAllowed) {
+            kernel.storeIndirectDataSnapshot(ioh, localWorkSize, offsetCrossThreadData);
+        }
+    }
 
     uint64_t offsetInterfaceDescriptor = offsetInterfaceDescriptorTable + interfaceDescriptorIndex * sizeof(INTERFACE_DESCRIPTOR_DATA);
     DEBUG_BREAK_IF(patchInfo.executionEnvironment == nullptr);
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/helpers/pitched_copy.h"
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/utilities/cpu_info.h"
+
+#include <cstring>
+
+namespace NEO {
+
+void (*PitchedCopyHelper::copyRows)(void *dst, size_t dstRowPitch, const void *src, size_t srcRowPitch, size_t rowSize, size_t rowsCount) = copyRowsSimd<uint8x16_t>;
+
+// Initialize the lookup table based on CPU capabilities
+PitchedCopyHelper::PitchedCopyHelper() {
+    bool supportsAVX2 = CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2);
+    if (supportsAVX2) {
+        PitchedCopyHelper::copyRows = copyRowsSimd<uint8x32_t>;
+    }
+}
+
+PitchedCopyHelper PitchedCopyHelper::initializer;
+
+void copyRowsWithMemcpy(void *dst, size_t dstRowPitch, const void *src, size_t srcRowPitch, size_t rowSize, size_t rowsCount) {
+    if (dstRowPitch == rowSize && srcRowPitch == rowSize) {
+        memcpy(dst, src, rowSize * rowsCount);
+        return;
+    }
+    for (size_t row = 0; row < rowsCount; row++) {
+        memcpy(ptrOffset(dst, row * dstRowPitch), ptrOffset(src, row * srcRowPitch), rowSize);
+    }
+}
+} // namespace NEO
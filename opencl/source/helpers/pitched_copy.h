@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace NEO {
+
+struct uint8x16_t;
+struct uint8x32_t;
+
+struct PitchedCopyHelper {
+    // Wider rows are left to memcpy, which already handles them efficiently
+    static constexpr size_t maxSimdRowSize = 512;
+
+    static void (*copyRows)(void *dst, size_t dstRowPitch, const void *src, size_t srcRowPitch, size_t rowSize, size_t rowsCount);
+
+    static PitchedCopyHelper initializer;
+
+  private:
+    PitchedCopyHelper();
+};
+
+template <typename Vec>
+void copyRowsSimd(void *dst, size_t dstRowPitch, const void *src, size_t srcRowPitch, size_t rowSize, size_t rowsCount);
+
+void copyRowsWithMemcpy(void *dst, size_t dstRowPitch, const void *src, size_t srcRowPitch, size_t rowSize, size_t rowsCount);
+} // namespace NEO
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/helpers/pitched_copy.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace NEO {
+
+template <typename Vec>
+inline void copyRowSimd(uint8_t *dst, const uint8_t *src, size_t rowSize) {
+    size_t offset = 0;
+    for (; offset + Vec::size <= rowSize; offset += Vec::size) {
+        Vec::store(dst + offset, Vec::load(src + offset));
+    }
+    if (offset < rowSize) {
+        // Remaining bytes are covered by a vector overlapping the previous one
+        offset = rowSize - Vec::size;
+        Vec::store(dst + offset, Vec::load(src + offset));
+    }
+}
+
+template <typename Vec>
+void copyRowsSimd(void *dst, size_t dstRowPitch, const void *src, size_t srcRowPitch, size_t rowSize, size_t rowsCount) {
+    if (rowSize < Vec::size || rowSize > PitchedCopyHelper::maxSimdRowSize ||
+        (dstRowPitch == rowSize && srcRowPitch == rowSize)) {
+        copyRowsWithMemcpy(dst, dstRowPitch, src, srcRowPitch, rowSize, rowsCount);
+        return;
+    }
+
+    auto dstRow = static_cast<uint8_t *>(dst);
+    auto srcRow = static_cast<const uint8_t *>(src);
+    for (size_t row = 0; row < rowsCount; row++) {
+        copyRowSimd<Vec>(dstRow, srcRow, rowSize);
+        dstRow += dstRowPitch;
+        srcRow += srcRowPitch;
+    }
+}
+} // namespace NEO
@@ -0,0 +1,28 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#if __AVX2__
+#include "opencl/source/helpers/pitched_copy.inl"
+
+#include <immintrin.h>
+
+namespace NEO {
+struct uint8x32_t {
+    static constexpr size_t size = sizeof(__m256i);
+
+    static inline __m256i load(const void *ptr) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+    }
+
+    static inline void store(void *ptr, __m256i value) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(ptr), value);
+    }
+};
+
+template void copyRowsSimd<uint8x32_t>(void *dst, size_t dstRowPitch, const void *src, size_t srcRowPitch, size_t rowSize, size_t rowsCount);
+} // namespace NEO
+#endif
@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/helpers/pitched_copy.inl"
+
+#include <immintrin.h>
+
+namespace NEO {
+struct uint8x16_t {
+    static constexpr size_t size = sizeof(__m128i);
+
+    static inline __m128i load(const void *ptr) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+    }
+
+    static inline void store(void *ptr, __m128i value) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(ptr), value);
+    }
+};
+
+template void copyRowsSimd<uint8x16_t>(void *dst, size_t dstRowPitch, const void *src, size_t srcRowPitch, size_t rowSize, size_t rowsCount);
+} // namespace NEO
@@ -10,14 +10,17 @@
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/bindless_heaps_helper.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/kernel_helpers.h"
 #include "shared/source/helpers/ptr_math.h"
+#include "shared/source/indirect_heap/indirect_heap.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
@@ -52,6 +55,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <vector>
 
 using namespace iOpenCL;
@@ -109,6 +113,13 @@ Kernel::Kernel(Program *programArg, const KernelInfo &kernelInfoArg, const ClDev
 }
 
 Kernel::~Kernel() {
+    auto bindlessHeapsHelper = device.getRootDeviceEnvironment().bindlessHeapsHelper.get();
+    for (auto ownedOffset : ownedBindlessSurfaceStates) {
+        if (bindlessHeapsHelper && isValidOffset(ownedOffset)) {
+            bindlessHeapsHelper->releaseSSInHeap(ownedOffset);
+        }
+    }
+
     delete[] crossThreadData;
     crossThreadData = nullptr;
     crossThreadDataSize = 0;
@@ -771,7 +782,7 @@ void Kernel::substituteKernelHeap(void *newKernelHeap, size_t newKernelHeapSize)
     auto currentAllocationSize = pKernelInfo->kernelAllocation->getUnderlyingBufferSize();
     bool status = false;
     if (currentAllocationSize >= newKernelHeapSize) {
-        status = memoryManager->copyMemoryToAllocation(pKernelInfo->kernelAllocation, newKernelHeap, newKernelHeapSize);
+        status = memoryManager->copyMemoryToAllocation(pKernelInfo->kernelAllocation, 0u, newKernelHeap, newKernelHeapSize);
     } else {
         memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(pKernelInfo->kernelAllocation);
         pKernelInfo->kernelAllocation = nullptr;
@@ -967,6 +978,7 @@ void Kernel::storeKernelArg(uint32_t argIndex, kernelArgType argType, void *argO
     kernelArguments[argIndex].size = argSize;
     kernelArguments[argIndex].pSvmAlloc = argSvmAlloc;
     kernelArguments[argIndex].svmFlags = argSvmFlags;
+    kernelArguments[argIndex].globalBindlessSurfaceStateOffset = undefined<uint32_t>;
 }
 
 const void *Kernel::getKernelArg(uint32_t argIndex) const {
@@ -1333,6 +1345,10 @@ cl_int Kernel::setArgBuffer(uint32_t argIndex,
             buffer->setArgStateful(surfaceState, forceNonAuxMode, disableL3, isAuxTranslationKernel, kernelArgInfo.isReadOnly, getDevice().getDevice());
         }
 
+        if (DebugManager.flags.UseBindlessBuffers.get() && !isBuiltIn && getDevice().getRootDeviceEnvironment().bindlessHeapsHelper) {
+            kernelArguments[argIndex].globalBindlessSurfaceStateOffset = buffer->setArgBindless(forceNonAuxMode, disableL3, isAuxTranslationKernel, kernelArgInfo.isReadOnly, getDevice().getDevice());
+        }
+
         kernelArguments[argIndex].isStatelessUncacheable = kernelArgInfo.pureStatefulBufferAccess ? false : buffer->isMemObjUncacheable();
 
         auto allocationForCacheFlush = graphicsAllocation;
@@ -2471,6 +2487,7 @@ void Kernel::patchBindlessSurfaceStateOffsets(const size_t sshOffset) {
     if (bindlessUsed) {
         auto &hardwareInfo = getDevice().getHardwareInfo();
         auto &hwHelper = HwHelper::get(hardwareInfo.platform.eRenderCoreFamily);
+        auto bindlessHeapsHelper = getDevice().getRootDeviceEnvironment().bindlessHeapsHelper.get();
 
         for (size_t i = 0; i < kernelInfo.kernelArgInfo.size(); i++) {
             if ((kernelInfo.kernelArgInfo[i].isBuffer && bindlessBuffers) ||
@@ -2479,7 +2496,17 @@ void Kernel::patchBindlessSurfaceStateOffsets(const size_t sshOffset) {
                 auto patchLocation = ptrOffset(getCrossThreadData(),
                                                kernelInfo.kernelArgInfo[i].kernelArgPatchInfoVector[0].crossthreadOffset);
 
-                auto bindlessOffset = static_cast<uint32_t>(sshOffset) + kernelInfo.kernelArgInfo[i].offsetHeap;
+                uint32_t bindlessOffset = 0;
+                if (bindlessHeapsHelper) {
+                    // buffers own their surface states in global heap, slots of other arguments are owned by kernel
+                    bindlessOffset = kernelArguments[i].globalBindlessSurfaceStateOffset;
+                    if (!isValidOffset(bindlessOffset)) {
+                        auto surfaceState = ptrOffset(getSurfaceStateHeap(), kernelInfo.kernelArgInfo[i].offsetHeap);
+                        bindlessOffset = programOwnedBindlessSurfaceState(static_cast<uint32_t>(i), surfaceState, *bindlessHeapsHelper);
+                    }
+                } else {
+                    bindlessOffset = static_cast<uint32_t>(sshOffset) + kernelInfo.kernelArgInfo[i].offsetHeap;
+                }
                 auto patchValue = hwHelper.getBindlessSurfaceExtendedMessageDescriptorValue(bindlessOffset);
                 patchWithRequiredSize(patchLocation, sizeof(patchValue), patchValue);
             }
@@ -2487,4 +2514,71 @@ void Kernel::patchBindlessSurfaceStateOffsets(const size_t sshOffset) {
     }
 }
 
+uint32_t Kernel::programOwnedBindlessSurfaceState(uint32_t argIndex, const void *surfaceState, BindlessHeapsHelper &bindlessHeapsHelper) {
+    // same kernel may be dispatched by queues of different engines at the same time
+    std::lock_guard<std::mutex> lock(ownedBindlessSurfaceStatesMutex);
+
+    auto surfaceStateSize = bindlessHeapsHelper.getSurfaceStateSize();
+    if (ownedBindlessSurfaceStates.size() <= argIndex) {
+        ownedBindlessSurfaceStates.resize(argIndex + 1, undefined<uint32_t>);
+    }
+
+    auto &ownedOffset = ownedBindlessSurfaceStates[argIndex];
+    if (isValidOffset(ownedOffset)) {
+        auto ownedSurfaceState = ptrOffset(bindlessHeapsHelper.getHeapAllocation()->getUnderlyingBuffer(), ownedOffset);
+        if (memcmp(ownedSurfaceState, surfaceState, surfaceStateSize) == 0) {
+            return ownedOffset;
+        }
+        // submitted work may still read the slot, so a new one is programmed instead of overwriting it
+        bindlessHeapsHelper.releaseSSInHeap(ownedOffset);
+    }
+
+    auto surfaceStateInHeap = bindlessHeapsHelper.allocateSSInHeap();
+    memcpy_s(surfaceStateInHeap.ssPtr, surfaceStateSize, surfaceState, surfaceStateSize);
+    ownedOffset = surfaceStateInHeap.surfaceStateOffset;
+    return ownedOffset;
+}
+
+bool Kernel::getReusableIndirectData(const IndirectHeap &ioh, const size_t localWorkSize[3], size_t &offsetCrossThreadData) {
+    std::lock_guard<std::mutex> lock(indirectDataSnapshotMutex);
+
+    // Previous indirect data stays valid as long as nothing was put into heap after it
+    if (indirectDataSnapshot.heapAllocation == nullptr ||
+        indirectDataSnapshot.heapAllocation != ioh.getGraphicsAllocation() ||
+        indirectDataSnapshot.heapBufferGeneration != ioh.getBufferGeneration() ||
+        indirectDataSnapshot.heapUsedAfterDispatch != ioh.getUsed() ||
+        indirectDataSnapshot.usingImagesOnly != usingImagesOnly) {
+        return false;
+    }
+    for (auto i = 0u; i < 3; i++) {
+        if (indirectDataSnapshot.localWorkSize[i] != localWorkSize[i]) {
+            return false;
+        }
+    }
+    if (indirectDataSnapshot.crossThreadDataSize != crossThreadDataSize ||
+        memcmp(indirectDataSnapshot.crossThreadData.get(), crossThreadData, crossThreadDataSize) != 0) {
+        return false;
+    }
+
+    offsetCrossThreadData = indirectDataSnapshot.offsetCrossThreadData;
+    return true;
+}
+
+void Kernel::storeIndirectDataSnapshot(const IndirectHeap &ioh, const size_t localWorkSize[3], size_t offsetCrossThreadData) {
+    std::lock_guard<std::mutex> lock(indirectDataSnapshotMutex);
+
+    if (indirectDataSnapshot.crossThreadDataSize != crossThreadDataSize || !indirectDataSnapshot.crossThreadData) {
+        indirectDataSnapshot.crossThreadData.reset(new char[crossThreadDataSize]);
+        indirectDataSnapshot.crossThreadDataSize = crossThreadDataSize;
+    }
+    memcpy_s(indirectDataSnapshot.crossThreadData.get(), crossThreadDataSize, crossThreadData, crossThreadDataSize);
+
+    indirectDataSnapshot.heapAllocation = ioh.getGraphicsAllocation();
+    indirectDataSnapshot.heapBufferGeneration = ioh.getBufferGeneration();
+    indirectDataSnapshot.heapUsedAfterDispatch = ioh.getUsed();
+    indirectDataSnapshot.offsetCrossThreadData = offsetCrossThreadData;
+    indirectDataSnapshot.localWorkSize = {{localWorkSize[0], localWorkSize[1], localWorkSize[2]}};
+    indirectDataSnapshot.usingImagesOnly = usingImagesOnly;
+}
+
 } // namespace NEO
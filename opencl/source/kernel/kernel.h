@@ -24,10 +24,13 @@
 #include "opencl/source/program/kernel_info.h"
 #include "opencl/source/program/program.h"
 
+#include <array>
+#include <mutex>
 #include <vector>
 
 namespace NEO {
 struct CompletionStamp;
+class BindlessHeapsHelper;
 class Buffer;
 class CommandStreamReceiver;
 class GraphicsAllocation;
@@ -67,6 +70,7 @@ class Kernel : public BaseObject<_cl_kernel> {
         cl_mem_flags svmFlags;
         bool isPatched = false;
         bool isStatelessUncacheable = false;
+        uint32_t globalBindlessSurfaceStateOffset = undefined<uint32_t>;
     };
 
     typedef int32_t (Kernel::*KernelArgHandler)(uint32_t argIndex,
@@ -414,6 +418,9 @@ class Kernel : public BaseObject<_cl_kernel> {
         const bool kernelUsesLocalIds,
         const bool isCssUsed) const;
 
+    bool getReusableIndirectData(const IndirectHeap &ioh, const size_t localWorkSize[3], size_t &offsetCrossThreadData);
+    void storeIndirectDataSnapshot(const IndirectHeap &ioh, const size_t localWorkSize[3], size_t offsetCrossThreadData);
+
     bool requiresPerDssBackedBuffer() const;
     bool requiresLimitedWorkgroupSize() const;
     bool isKernelDebugEnabled() const { return debugEnabled; }
@@ -505,6 +512,8 @@ class Kernel : public BaseObject<_cl_kernel> {
 
     void reconfigureKernel();
 
+    uint32_t programOwnedBindlessSurfaceState(uint32_t argIndex, const void *surfaceState, BindlessHeapsHelper &bindlessHeapsHelper);
+
     void addAllocationToCacheFlushVector(uint32_t argIndex, GraphicsAllocation *argAllocation);
     bool allocationForCacheFlush(GraphicsAllocation *argAllocation) const;
     Program *program;
@@ -545,9 +554,25 @@ class Kernel : public BaseObject<_cl_kernel> {
     std::vector<PatchInfoData> patchInfoDataList;
     std::unique_ptr<ImageTransformer> imageTransformer;
 
+    // Describes indirect data uploaded by the last dispatch of this kernel
+    struct IndirectDataSnapshot {
+        std::unique_ptr<char[]> crossThreadData;
+        uint32_t crossThreadDataSize = 0;
+        const GraphicsAllocation *heapAllocation = nullptr;
+        uint64_t heapBufferGeneration = 0;
+        size_t heapUsedAfterDispatch = 0;
+        size_t offsetCrossThreadData = 0;
+        std::array<size_t, 3> localWorkSize = {};
+        bool usingImagesOnly = false;
+    };
+    IndirectDataSnapshot indirectDataSnapshot;
+    std::mutex indirectDataSnapshotMutex;
+
     bool specialPipelineSelectMode = false;
     bool svmAllocationsRequireCacheFlush = false;
     std::vector<GraphicsAllocation *> kernelArgRequiresCacheFlush;
+    std::vector<uint32_t> ownedBindlessSurfaceStates;
+    std::mutex ownedBindlessSurfaceStatesMutex;
     UnifiedMemoryControls unifiedMemoryControls;
     bool isUnifiedMemorySyncRequired = true;
     bool debugEnabled = false;
@@ -13,6 +13,7 @@
 #include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/bindless_heaps_helper.h"
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/hw_info.h"
@@ -71,7 +72,9 @@ Buffer::Buffer(Context *context,
 Buffer::Buffer() : MemObj(nullptr, CL_MEM_OBJECT_BUFFER, {}, 0, 0, 0, nullptr, nullptr, 0, false, false, false) {
 }
 
-Buffer::~Buffer() = default;
+Buffer::~Buffer() {
+    releaseBindlessSurfaceStates();
+}
 
 bool Buffer::isSubBuffer() {
     return this->associatedMemObject != nullptr;
@@ -488,6 +491,35 @@ Buffer *Buffer::createSubBuffer(cl_mem_flags flags,
     return buffer;
 }
 
+uint32_t Buffer::setArgBindless(bool forceNonAuxMode, bool disableL3, bool alignSizeForAuxTranslation, bool isReadOnly, const Device &device) {
+    auto rootDeviceIndex = device.getRootDeviceIndex();
+    auto bindlessHeapsHelper = device.getRootDeviceEnvironment().bindlessHeapsHelper.get();
+    UNRECOVERABLE_IF(bindlessHeapsHelper == nullptr);
+
+    uint32_t surfaceStateFlags = (forceNonAuxMode ? 1u : 0u) | (disableL3 ? 2u : 0u) | (alignSizeForAuxTranslation ? 4u : 0u) | (isReadOnly ? 8u : 0u);
+    BindlessSurfaceStateKey key{rootDeviceIndex, surfaceStateFlags, getBufferAddress(rootDeviceIndex)};
+
+    std::lock_guard<std::mutex> lock(bindlessSurfaceStatesMutex);
+    auto it = bindlessSurfaceStateOffsets.find(key);
+    if (it != bindlessSurfaceStateOffsets.end()) {
+        return it->second.second;
+    }
+
+    // surface state in global heap is programmed once and stays unchanged until buffer is destroyed
+    auto surfaceStateInHeap = bindlessHeapsHelper->allocateSSInHeap();
+    setArgStateful(surfaceStateInHeap.ssPtr, forceNonAuxMode, disableL3, alignSizeForAuxTranslation, isReadOnly, device);
+    bindlessSurfaceStateOffsets.insert({key, {bindlessHeapsHelper, surfaceStateInHeap.surfaceStateOffset}});
+    return surfaceStateInHeap.surfaceStateOffset;
+}
+
+void Buffer::releaseBindlessSurfaceStates() {
+    // slots are reused by the heap only after submissions that could reference them have completed
+    for (auto &surfaceState : bindlessSurfaceStateOffsets) {
+        surfaceState.second.first->releaseSSInHeap(surfaceState.second.second);
+    }
+    bindlessSurfaceStateOffsets.clear();
+}
+
 uint64_t Buffer::setArgStateless(void *memory, uint32_t patchSize, uint32_t rootDeviceIndex, bool set32BitAddressing) {
     // Subbuffers have offset that graphicsAllocation is not aware of
     auto graphicsAllocation = multiGraphicsAllocation.getGraphicsAllocation(rootDeviceIndex);
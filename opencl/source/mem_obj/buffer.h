@@ -17,8 +17,12 @@
 #include "memory_properties_flags.h"
 
 #include <functional>
+#include <map>
+#include <mutex>
+#include <tuple>
 
 namespace NEO {
+class BindlessHeapsHelper;
 class Device;
 class Buffer;
 class ClDevice;
@@ -136,6 +140,7 @@ class Buffer : public MemObj {
     bool isValidSubBufferOffset(size_t offset);
     uint64_t setArgStateless(void *memory, uint32_t patchSize, uint32_t rootDeviceIndex, bool set32BitAddressing);
     virtual void setArgStateful(void *memory, bool forceNonAuxMode, bool disableL3, bool alignSizeForAuxTranslation, bool isReadOnly, const Device &device) = 0;
+    uint32_t setArgBindless(bool forceNonAuxMode, bool disableL3, bool alignSizeForAuxTranslation, bool isReadOnly, const Device &device);
     bool bufferRectPitchSet(const size_t *bufferOrigin,
                             const size_t *region,
                             size_t &bufferRowPitch,
@@ -186,6 +191,11 @@ class Buffer : public MemObj {
     static bool isReadOnlyMemoryPermittedByFlags(const MemoryProperties &properties);
 
     void transferData(void *dst, void *src, size_t copySize, size_t copyOffset);
+    void releaseBindlessSurfaceStates();
+
+    using BindlessSurfaceStateKey = std::tuple<uint32_t, uint32_t, uint64_t>;
+    std::map<BindlessSurfaceStateKey, std::pair<BindlessHeapsHelper *, uint32_t>> bindlessSurfaceStateOffsets;
+    std::mutex bindlessSurfaceStatesMutex;
 };
 
 template <typename GfxFamily>
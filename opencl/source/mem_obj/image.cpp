@@ -28,6 +28,7 @@
 #include "opencl/source/helpers/gmm_types_converter.h"
 #include "opencl/source/helpers/memory_properties_helpers.h"
 #include "opencl/source/helpers/mipmap.h"
+#include "opencl/source/helpers/pitched_copy.h"
 #include "opencl/source/helpers/surface_formats.h"
 #include "opencl/source/mem_obj/buffer.h"
 #include "opencl/source/mem_obj/mem_obj_helper.h"
@@ -103,17 +104,14 @@ void Image::transferData(void *dest, size_t destRowPitch, size_t destSlicePitch,
         std::swap(copyRegion[1], copyRegion[2]);
     }
 
-    for (size_t slice = copyOrigin[2]; slice < (copyOrigin[2] + copyRegion[2]); slice++) {
-        auto srcSliceOffset = ptrOffset(src, srcSlicePitch * slice);
-        auto dstSliceOffset = ptrOffset(dest, destSlicePitch * slice);
+    auto srcOriginOffset = srcRowPitch * copyOrigin[1] + copyOrigin[0] * pixelSize;
+    auto dstOriginOffset = destRowPitch * copyOrigin[1] + copyOrigin[0] * pixelSize;
 
-        for (size_t height = copyOrigin[1]; height < (copyOrigin[1] + copyRegion[1]); height++) {
-            auto srcRowOffset = ptrOffset(srcSliceOffset, srcRowPitch * height);
-            auto dstRowOffset = ptrOffset(dstSliceOffset, destRowPitch * height);
+    for (size_t slice = copyOrigin[2]; slice < (copyOrigin[2] + copyRegion[2]); slice++) {
+        auto srcSliceOffset = ptrOffset(src, srcSlicePitch * slice + srcOriginOffset);
+        auto dstSliceOffset = ptrOffset(dest, destSlicePitch * slice + dstOriginOffset);
 
-            memcpy_s(ptrOffset(dstRowOffset, copyOrigin[0] * pixelSize), lineWidth,
-                     ptrOffset(srcRowOffset, copyOrigin[0] * pixelSize), lineWidth);
-        }
+        PitchedCopyHelper::copyRows(dstSliceOffset, destRowPitch, srcSliceOffset, srcRowPitch, lineWidth, copyRegion[1]);
     }
 }
 
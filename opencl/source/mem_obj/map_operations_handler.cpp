@@ -25,50 +25,72 @@ bool MapOperationsHandler::add(void *ptr, size_t ptrLength, cl_map_flags &mapFla
         return false;
     }
 
-    mappedPointers.push_back(mapInfo);
+    auto startPtr = reinterpret_cast<uintptr_t>(ptr);
+    mappedPointers.emplace(startPtr, mapInfo);
+    updateMappedRanges(startPtr, startPtr + ptrLength, 1);
     return true;
 }
 
 bool MapOperationsHandler::isOverlapping(MapInfo &inputMapInfo) {
-    if (inputMapInfo.readOnly) {
+    if (inputMapInfo.readOnly || mappedRanges.empty()) {
         return false;
     }
-    auto inputStartPtr = inputMapInfo.ptr;
-    auto inputEndPtr = ptrOffset(inputStartPtr, inputMapInfo.ptrLength);
+    auto inputStartPtr = reinterpret_cast<uintptr_t>(inputMapInfo.ptr);
+    auto inputEndPtr = inputStartPtr + inputMapInfo.ptrLength;
 
-    for (auto &mapInfo : mappedPointers) {
-        auto mappedStartPtr = mapInfo.ptr;
-        auto mappedEndPtr = ptrOffset(mappedStartPtr, mapInfo.ptrLength);
+    // Requested ptr starts inside existing ptr range
+    auto nextRange = mappedRanges.upper_bound(inputStartPtr);
+    if (nextRange != mappedRanges.begin() && std::prev(nextRange)->second > 0) {
+        return true;
+    }
+    // Requested ptr starts before existing ptr range and overlapping its start,
+    // range following the one without mappings always has some
+    return nextRange != mappedRanges.end() && nextRange->first <= inputEndPtr;
+}
+
+void MapOperationsHandler::updateMappedRanges(uintptr_t startPtr, uintptr_t endPtr, int32_t mapsCountChange) {
+    if (startPtr >= endPtr) {
+        return;
+    }
+    auto getMapsCountAt = [this](uintptr_t ptr) -> uint32_t {
+        auto nextRange = mappedRanges.upper_bound(ptr);
+        return (nextRange == mappedRanges.begin()) ? 0u : std::prev(nextRange)->second;
+    };
+    mappedRanges.emplace(endPtr, getMapsCountAt(endPtr));
+    auto startRange = mappedRanges.emplace(startPtr, getMapsCountAt(startPtr)).first;
+
+    auto endRange = mappedRanges.find(endPtr);
+    for (auto range = startRange; range != endRange; range++) {
+        range->second += mapsCountChange;
+    }
 
-        // Requested ptr starts before or inside existing ptr range and overlapping end
-        if (inputStartPtr < mappedEndPtr && inputEndPtr >= mappedStartPtr) {
-            return true;
+    // merge ranges with equal count of mappings at both edges of updated range
+    for (auto range : {endRange, startRange}) {
+        auto previousMapsCount = (range == mappedRanges.begin()) ? 0u : std::prev(range)->second;
+        if (range->second == previousMapsCount) {
+            mappedRanges.erase(range);
         }
     }
-    return false;
 }
 
 bool MapOperationsHandler::find(void *mappedPtr, MapInfo &outMapInfo) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    for (auto &mapInfo : mappedPointers) {
-        if (mapInfo.ptr == mappedPtr) {
-            outMapInfo = mapInfo;
-            return true;
-        }
+    auto it = mappedPointers.lower_bound(reinterpret_cast<uintptr_t>(mappedPtr));
+    if (it == mappedPointers.end() || it->first != reinterpret_cast<uintptr_t>(mappedPtr)) {
+        return false;
     }
-    return false;
+    outMapInfo = it->second;
+    return true;
 }
 
 void MapOperationsHandler::remove(void *mappedPtr) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    auto endIter = mappedPointers.end();
-    for (auto it = mappedPointers.begin(); it != endIter; it++) {
-        if (it->ptr == mappedPtr) {
-            std::iter_swap(it, mappedPointers.end() - 1);
-            mappedPointers.pop_back();
-            break;
-        }
+    auto it = mappedPointers.lower_bound(reinterpret_cast<uintptr_t>(mappedPtr));
+    if (it == mappedPointers.end() || it->first != reinterpret_cast<uintptr_t>(mappedPtr)) {
+        return;
     }
+    updateMappedRanges(it->first, it->first + it->second.ptrLength, -1);
+    mappedPointers.erase(it);
 }
@@ -8,8 +8,9 @@
 #pragma once
 #include "opencl/source/helpers/properties_helper.h"
 
+#include <cstdint>
+#include <map>
 #include <mutex>
-#include <vector>
 
 namespace NEO {
 
@@ -24,7 +25,13 @@ class MapOperationsHandler {
 
   protected:
     bool isOverlapping(MapInfo &inputMapInfo);
-    std::vector<MapInfo> mappedPointers;
+    void updateMappedRanges(uintptr_t startPtr, uintptr_t endPtr, int32_t mapsCountChange);
+
+    // Mappings ordered by start address; read-only maps may share a start address.
+    std::multimap<uintptr_t, MapInfo> mappedPointers;
+    // Number of mappings covering each address range, keyed by range start.
+    // Last range always has no mappings and neighbouring ranges differ in count.
+    std::map<uintptr_t, uint32_t> mappedRanges;
     mutable std::mutex mtx;
 };
 
@@ -18,6 +18,7 @@
 #include "opencl/source/platform/platform.h"
 
 #include "compiler_options.h"
+#include "config.h"
 #include "program.h"
 
 #include <cstring>
@@ -148,6 +149,7 @@ cl_int Program::compile(
         inputArgs.src = ArrayRef<const char>(reinterpret_cast<const char *>(compileData.data()), compileData.size());
         inputArgs.apiOptions = ArrayRef<const char>(options.c_str(), options.length());
         inputArgs.internalOptions = ArrayRef<const char>(internalOptions.c_str(), internalOptions.length());
+        inputArgs.allowCaching = clCacheEnabled;
 
         TranslationOutput compilerOuput;
         auto compilerErr = pCompilerInterface->compile(*this->pDevice, inputArgs, compilerOuput);
@@ -427,7 +427,7 @@ bool KernelInfo::createKernelAllocation(const Device &device) {
     if (!kernelAllocation) {
         return false;
     }
-    return device.getMemoryManager()->copyMemoryToAllocation(kernelAllocation, heapInfo.pKernelHeap, kernelIsaSize);
+    return device.getMemoryManager()->copyMemoryToAllocation(kernelAllocation, 0u, heapInfo.pKernelHeap, kernelIsaSize);
 }
 
 void KernelInfo::apply(const DeviceInfoKernelPayloadConstants &constants) {
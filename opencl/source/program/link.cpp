@@ -22,6 +22,7 @@
 #include "opencl/source/program/program.h"
 
 #include "compiler_options.h"
+#include "config.h"
 
 #include <cstring>
 
@@ -144,6 +145,7 @@ cl_int Program::link(
         inputArgs.apiOptions = ArrayRef<const char>(options.c_str(), options.length());
         inputArgs.internalOptions = ArrayRef<const char>(internalOptions.c_str(), internalOptions.length());
         inputArgs.GTPinInput = gtpinGetIgcInit();
+        inputArgs.allowCaching = clCacheEnabled;
 
         if (!isCreateLibrary) {
             inputArgs.outType = IGC::CodeType::oclGenBin;
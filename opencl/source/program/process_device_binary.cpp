@@ -12,6 +12,7 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/program/parallel_kernel_decoding.h"
 #include "shared/source/program/program_info.h"
 #include "shared/source/program/program_initialization.h"
 
@@ -24,6 +25,7 @@
 #include "program_debug_data.h"
 
 #include <algorithm>
+#include <atomic>
 
 using namespace iOpenCL;
 
@@ -109,7 +111,7 @@ cl_int Program::linkBinary(Device *pDevice, const void *constantsInitData, const
             }
             auto &kernHeapInfo = kernelInfo->heapInfo;
             auto segmentId = &kernelInfo - &this->kernelInfoArray[0];
-            this->pDevice->getMemoryManager()->copyMemoryToAllocation(kernelInfo->getGraphicsAllocation(),
+            this->pDevice->getMemoryManager()->copyMemoryToAllocation(kernelInfo->getGraphicsAllocation(), 0u,
                                                                       isaSegmentsForPatching[segmentId].hostPointer,
                                                                       kernHeapInfo.KernelHeapSize);
         }
@@ -188,9 +190,23 @@ cl_int Program::processProgramInfo(ProgramInfo &src) {
         }
     }
 
+    auto threadsCount = ParallelKernelDecoding::getThreadsCount(this->kernelInfoArray.size());
+    if ((threadsCount > 1) && this->pDevice) {
+        std::atomic<bool> allocationFailed{false};
+        parallelFor(this->kernelInfoArray.size(), threadsCount, [&](size_t kernelId) {
+            auto kernelInfo = this->kernelInfoArray[kernelId];
+            if (kernelInfo->heapInfo.KernelHeapSize && (false == kernelInfo->createKernelAllocation(*this->pDevice))) {
+                allocationFailed = true;
+            }
+        });
+        if (allocationFailed) {
+            return CL_OUT_OF_HOST_MEMORY;
+        }
+    }
+
     for (auto &kernelInfo : this->kernelInfoArray) {
         cl_int retVal = CL_SUCCESS;
-        if (kernelInfo->heapInfo.KernelHeapSize && this->pDevice) {
+        if (kernelInfo->heapInfo.KernelHeapSize && this->pDevice && (nullptr == kernelInfo->getGraphicsAllocation())) {
             retVal = kernelInfo->createKernelAllocation(*this->pDevice) ? CL_SUCCESS : CL_OUT_OF_HOST_MEMORY;
         }
 
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "opencl/source/command_queue/local_id_gen.h"
+#include "opencl/source/command_queue/local_ids_cache.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+using namespace NEO;
+
+struct MockLocalIdsCache : LocalIdsCache {
+    using LocalIdsCache::maxCachedEntries;
+};
+
+TEST(LocalIdsCacheTest, givenSameGroupShapeWhenGettingPerThreadDataThenCachedBlockIsReturned) {
+    LocalIdsCache cache;
+    std::array<uint16_t, 3> lws = {{8, 4, 2}};
+    std::array<uint8_t, 3> dimensionsOrder = {{0, 1, 2}};
+
+    auto first = cache.getPerThreadData(16, 32, 3, lws, dimensionsOrder, false);
+    auto second = cache.getPerThreadData(16, 32, 3, lws, dimensionsOrder, false);
+
+    ASSERT_NE(nullptr, first.perThreadData.get());
+    EXPECT_EQ(first.perThreadData.get(), second.perThreadData.get());
+    EXPECT_EQ(first.perThreadDataSize, second.perThreadDataSize);
+    EXPECT_EQ(1u, cache.getCachedEntriesCount());
+}
+
+TEST(LocalIdsCacheTest, givenDifferentGroupShapesWhenGettingPerThreadDataThenSeparateBlocksAreReturned) {
+    LocalIdsCache cache;
+    std::array<uint16_t, 3> lws = {{8, 4, 2}};
+    std::array<uint16_t, 3> otherLws = {{4, 8, 2}};
+    std::array<uint8_t, 3> dimensionsOrder = {{0, 1, 2}};
+    std::array<uint8_t, 3> otherDimensionsOrder = {{1, 0, 2}};
+
+    auto entry = cache.getPerThreadData(16, 32, 3, lws, dimensionsOrder, false);
+    EXPECT_NE(entry.perThreadData.get(), cache.getPerThreadData(16, 32, 3, otherLws, dimensionsOrder, false).perThreadData.get());
+    EXPECT_NE(entry.perThreadData.get(), cache.getPerThreadData(16, 32, 3, lws, otherDimensionsOrder, false).perThreadData.get());
+    EXPECT_NE(entry.perThreadData.get(), cache.getPerThreadData(32, 32, 3, lws, dimensionsOrder, false).perThreadData.get());
+    EXPECT_NE(entry.perThreadData.get(), cache.getPerThreadData(16, 64, 3, lws, dimensionsOrder, false).perThreadData.get());
+    EXPECT_EQ(5u, cache.getCachedEntriesCount());
+}
+
+TEST(LocalIdsCacheTest, whenGettingPerThreadDataThenBlockMatchesGeneratedLocalIds) {
+    LocalIdsCache cache;
+    std::array<uint16_t, 3> lws = {{7, 5, 3}};
+    std::array<uint8_t, 3> dimensionsOrder = {{2, 0, 1}};
+    uint16_t simd = 32;
+    uint32_t grfSize = 32;
+
+    auto entry = cache.getPerThreadData(simd, grfSize, 3, lws, dimensionsOrder, false);
+    auto expectedSize = getThreadsPerWG(simd, lws[0] * lws[1] * lws[2]) * getPerThreadSizeLocalIDs(simd, grfSize);
+    ASSERT_EQ(expectedSize, entry.perThreadDataSize);
+    EXPECT_TRUE(isAligned<64>(entry.perThreadData.get()));
+
+    auto expected = static_cast<uint8_t *>(alignedMalloc(expectedSize, 32));
+    generateLocalIDs(expected, simd, lws, dimensionsOrder, false, grfSize);
+    EXPECT_EQ(0, memcmp(expected, entry.perThreadData.get(), expectedSize));
+    alignedFree(expected);
+}
+
+TEST(LocalIdsCacheTest, givenNoLocalIdChannelsWhenGettingPerThreadDataThenZeroedBlockIsReturned) {
+    LocalIdsCache cache;
+    std::array<uint16_t, 3> lws = {{16, 1, 1}};
+    std::array<uint8_t, 3> dimensionsOrder = {{0, 1, 2}};
+
+    auto entry = cache.getPerThreadData(8, 32, 0, lws, dimensionsOrder, false);
+    ASSERT_EQ(2u * 32u, entry.perThreadDataSize);
+    for (uint32_t i = 0; i < entry.perThreadDataSize; i++) {
+        EXPECT_EQ(0u, entry.perThreadData.get()[i]);
+    }
+}
+
+TEST(LocalIdsCacheTest, givenDefaultSettingsWhenCacheIsCreatedThenDefaultEntriesLimitIsUsed) {
+    MockLocalIdsCache cache;
+    EXPECT_EQ(LocalIdsCache::defaultMaxCachedEntries, cache.maxCachedEntries);
+}
+
+TEST(LocalIdsCacheTest, givenLocalIdsCacheMaxEntriesDebugFlagWhenCacheIsCreatedThenEntriesLimitIsOverridden) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.LocalIdsCacheMaxEntries.set(3);
+    MockLocalIdsCache cache;
+    EXPECT_EQ(3u, cache.maxCachedEntries);
+}
+
+TEST(LocalIdsCacheTest, givenCacheFullOfReferencedBlocksWhenGettingPerThreadDataForNewGroupShapeThenUncachedBlockIsReturned) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.LocalIdsCacheMaxEntries.set(2);
+    LocalIdsCache cache;
+    std::array<uint16_t, 3> firstLws = {{8, 4, 2}};
+    std::array<uint16_t, 3> secondLws = {{4, 8, 2}};
+    std::array<uint16_t, 3> newLws = {{2, 4, 8}};
+    std::array<uint8_t, 3> dimensionsOrder = {{0, 1, 2}};
+
+    auto first = cache.getPerThreadData(16, 32, 3, firstLws, dimensionsOrder, false);
+    auto second = cache.getPerThreadData(16, 32, 3, secondLws, dimensionsOrder, false);
+    EXPECT_EQ(2u, cache.getCachedEntriesCount());
+
+    auto uncached = cache.getPerThreadData(16, 32, 3, newLws, dimensionsOrder, false);
+    EXPECT_EQ(2u, cache.getCachedEntriesCount());
+    ASSERT_NE(nullptr, uncached.perThreadData.get());
+    EXPECT_EQ(1, uncached.perThreadData.use_count());
+
+    auto expectedSize = getThreadsPerWG(16, newLws[0] * newLws[1] * newLws[2]) * getPerThreadSizeLocalIDs(16, 32);
+    ASSERT_EQ(expectedSize, uncached.perThreadDataSize);
+    auto expected = static_cast<uint8_t *>(alignedMalloc(expectedSize, 32));
+    generateLocalIDs(expected, 16, newLws, dimensionsOrder, false, 32);
+    EXPECT_EQ(0, memcmp(expected, uncached.perThreadData.get(), expectedSize));
+    alignedFree(expected);
+
+    EXPECT_NE(uncached.perThreadData.get(), cache.getPerThreadData(16, 32, 3, newLws, dimensionsOrder, false).perThreadData.get());
+    EXPECT_EQ(first.perThreadData.get(), cache.getPerThreadData(16, 32, 3, firstLws, dimensionsOrder, false).perThreadData.get());
+    EXPECT_EQ(second.perThreadData.get(), cache.getPerThreadData(16, 32, 3, secondLws, dimensionsOrder, false).perThreadData.get());
+}
+
+TEST(LocalIdsCacheTest, givenCacheFullWhenCachedBlockIsNoLongerReferencedThenItIsEvictedForNewGroupShape) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.LocalIdsCacheMaxEntries.set(2);
+    LocalIdsCache cache;
+    std::array<uint16_t, 3> referencedLws = {{8, 4, 2}};
+    std::array<uint16_t, 3> releasedLws = {{4, 8, 2}};
+    std::array<uint16_t, 3> newLws = {{2, 4, 8}};
+    std::array<uint8_t, 3> dimensionsOrder = {{0, 1, 2}};
+
+    auto referenced = cache.getPerThreadData(16, 32, 3, referencedLws, dimensionsOrder, false);
+    cache.getPerThreadData(16, 32, 3, releasedLws, dimensionsOrder, false);
+    EXPECT_EQ(2u, cache.getCachedEntriesCount());
+
+    auto newEntry = cache.getPerThreadData(16, 32, 3, newLws, dimensionsOrder, false);
+    EXPECT_EQ(2u, cache.getCachedEntriesCount());
+    EXPECT_EQ(2, newEntry.perThreadData.use_count());
+    EXPECT_EQ(newEntry.perThreadData.get(), cache.getPerThreadData(16, 32, 3, newLws, dimensionsOrder, false).perThreadData.get());
+    EXPECT_EQ(referenced.perThreadData.get(), cache.getPerThreadData(16, 32, 3, referencedLws, dimensionsOrder, false).perThreadData.get());
+}
+
+TEST(LocalIdsCacheTest, givenZeroEntriesLimitWhenGettingPerThreadDataThenEveryCallerGetsOwnBlock) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.LocalIdsCacheMaxEntries.set(0);
+    LocalIdsCache cache;
+    std::array<uint16_t, 3> lws = {{8, 4, 2}};
+    std::array<uint8_t, 3> dimensionsOrder = {{0, 1, 2}};
+
+    auto first = cache.getPerThreadData(16, 32, 3, lws, dimensionsOrder, false);
+    auto second = cache.getPerThreadData(16, 32, 3, lws, dimensionsOrder, false);
+    EXPECT_EQ(0u, cache.getCachedEntriesCount());
+    ASSERT_NE(nullptr, first.perThreadData.get());
+    EXPECT_NE(first.perThreadData.get(), second.perThreadData.get());
+    EXPECT_EQ(0, memcmp(first.perThreadData.get(), second.perThreadData.get(), first.perThreadDataSize));
+}
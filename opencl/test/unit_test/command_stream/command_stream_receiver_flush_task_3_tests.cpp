@@ -454,6 +454,140 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWhenBlocking
     EXPECT_TRUE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
 }
 
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenAdaptiveBatchedDispatchWhenNumberOfBatchedTasksReachesLimitThenBatchIsSubmitted) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.AdaptiveBatchedDispatchMaxTasks.set(2);
+
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
+    pDevice->resetCommandStreamReceiver(mockCsr);
+
+    mockCsr->enableAdaptiveBatchedDispatch();
+    EXPECT_TRUE(mockCsr->isAdaptiveBatchedDispatchEnabled());
+
+    auto mockedSubmissionsAggregator = new mockSubmissionsAggregator();
+    mockCsr->overrideSubmissionAggregator(mockedSubmissionsAggregator);
+
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.adaptiveBatchedDispatch = true;
+
+    mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(0, mockCsr->flushCalledCount);
+    EXPECT_FALSE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
+
+    mockCsr->flushTask(commandStream, commandStream.getUsed(), dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+    EXPECT_TRUE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
+
+    mockCsr->flushTask(commandStream, commandStream.getUsed(), dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+    EXPECT_FALSE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenAdaptiveBatchedDispatchWhenTaskOfQueueWithoutAdaptiveBatchingIsFlushedThenItIsSubmittedImmediately) {
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
+    pDevice->resetCommandStreamReceiver(mockCsr);
+
+    mockCsr->enableAdaptiveBatchedDispatch();
+
+    auto mockedSubmissionsAggregator = new mockSubmissionsAggregator();
+    mockCsr->overrideSubmissionAggregator(mockedSubmissionsAggregator);
+
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.adaptiveBatchedDispatch = true;
+
+    mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(0, mockCsr->flushCalledCount);
+
+    dispatchFlags.adaptiveBatchedDispatch = false;
+    mockCsr->flushTask(commandStream, commandStream.getUsed(), dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+    EXPECT_TRUE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenAdaptiveBatchedDispatchAndBatchedCsrWhenTaskOfQueueWithoutAdaptiveBatchingIsFlushedThenItIsBatched) {
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
+    pDevice->resetCommandStreamReceiver(mockCsr);
+
+    mockCsr->enableAdaptiveBatchedDispatch();
+    mockCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatch);
+
+    auto mockedSubmissionsAggregator = new mockSubmissionsAggregator();
+    mockCsr->overrideSubmissionAggregator(mockedSubmissionsAggregator);
+
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+
+    mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(0, mockCsr->flushCalledCount);
+    EXPECT_FALSE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenAdaptiveBatchedDispatchWhenLastQueueUsingItIsDestroyedThenBatchIsSubmittedAndDispatchModeIsRestored) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableAdaptiveBatchedDispatch.set(1);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
+    pDevice->resetCommandStreamReceiver(mockCsr);
+
+    auto mockedSubmissionsAggregator = new mockSubmissionsAggregator();
+    mockCsr->overrideSubmissionAggregator(mockedSubmissionsAggregator);
+
+    auto firstQueue = std::make_unique<CommandQueueHw<FamilyType>>(nullptr, pClDevice, nullptr, false);
+    auto secondQueue = std::make_unique<CommandQueueHw<FamilyType>>(nullptr, pClDevice, nullptr, false);
+    EXPECT_TRUE(mockCsr->isAdaptiveBatchedDispatchEnabled());
+
+    auto &commandStream = firstQueue->getCS(4096u);
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.adaptiveBatchedDispatch = true;
+
+    mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(0, mockCsr->flushCalledCount);
+
+    secondQueue.reset();
+    EXPECT_TRUE(mockCsr->isAdaptiveBatchedDispatchEnabled());
+    EXPECT_EQ(DispatchMode::BatchedDispatch, mockCsr->dispatchMode);
+    EXPECT_EQ(0, mockCsr->flushCalledCount);
+
+    firstQueue.reset();
+    EXPECT_FALSE(mockCsr->isAdaptiveBatchedDispatchEnabled());
+    EXPECT_EQ(DispatchMode::ImmediateDispatch, mockCsr->dispatchMode);
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+    EXPECT_TRUE(mockedSubmissionsAggregator->peekCmdBufferList().peekIsEmpty());
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenAdaptiveBatchedDispatchEnabledWhenInOrderQueueIsCreatedThenCsrUsesAdaptiveBatching) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableAdaptiveBatchedDispatch.set(1);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
+    pDevice->resetCommandStreamReceiver(mockCsr);
+    EXPECT_FALSE(mockCsr->isAdaptiveBatchedDispatchEnabled());
+
+    cl_queue_properties outOfOrderProperties[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, 0};
+    CommandQueueHw<FamilyType> outOfOrderQueue(nullptr, pClDevice, outOfOrderProperties, false);
+    EXPECT_FALSE(mockCsr->isAdaptiveBatchedDispatchEnabled());
+
+    CommandQueueHw<FamilyType> inOrderQueue(nullptr, pClDevice, 0, false);
+    EXPECT_TRUE(mockCsr->isAdaptiveBatchedDispatchEnabled());
+    EXPECT_EQ(DispatchMode::BatchedDispatch, mockCsr->dispatchMode);
+}
+
 HWTEST_F(CommandStreamReceiverFlushTaskTests, givenBufferToFlushWhenFlushTaskCalledThenUpdateFlushStamp) {
     auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
     pDevice->resetCommandStreamReceiver(mockCsr);
@@ -904,7 +1038,7 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWithOutOfOrd
     EXPECT_TRUE(pipeControl->getDcFlushEnable());
 }
 
-HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWhenDcFlushIsRequiredThenPipeControlIsNotRegistredForNooping) {
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWithTimestampPacketWriteWhenDcFlushIsRequiredThenPipeControlIsNotRegistredForNooping) {
     CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
     auto &commandStream = commandQueue.getCS(4096u);
 
@@ -912,6 +1046,7 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWhenDcFlushI
     pDevice->resetCommandStreamReceiver(mockCsr);
 
     mockCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatch);
+    mockCsr->timestampPacketWriteEnabled = true;
 
     auto mockedSubmissionsAggregator = new mockSubmissionsAggregator();
     mockCsr->overrideSubmissionAggregator(mockedSubmissionsAggregator);
@@ -935,6 +1070,80 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWhenDcFlushI
     EXPECT_NE(nullptr, cmdBuffer->epiloguePipeControlLocation);
 }
 
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWithoutTimestampPacketWriteWhenDcFlushIsRequiredThenPipeControlIsRegisteredForNoopingWithDcFlush) {
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
+    pDevice->resetCommandStreamReceiver(mockCsr);
+
+    mockCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatch);
+    mockCsr->timestampPacketWriteEnabled = false;
+
+    auto mockedSubmissionsAggregator = new mockSubmissionsAggregator();
+    mockCsr->overrideSubmissionAggregator(mockedSubmissionsAggregator);
+
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.dcFlush = true;
+    dispatchFlags.outOfOrderExecutionAllowed = true;
+
+    mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+
+    auto cmdBuffer = mockedSubmissionsAggregator->peekCommandBuffers().peekHead();
+    EXPECT_EQ(cmdBuffer->epiloguePipeControlLocation, cmdBuffer->pipeControlThatMayBeErasedLocation);
+    EXPECT_TRUE(cmdBuffer->pipeControlThatMayBeErasedFlushesDc);
+
+    dispatchFlags.dcFlush = false;
+    mockCsr->flushTask(commandStream, commandStream.getUsed(), dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+
+    auto secondCmdBuffer = cmdBuffer->next;
+    EXPECT_NE(nullptr, secondCmdBuffer->pipeControlThatMayBeErasedLocation);
+    EXPECT_FALSE(secondCmdBuffer->pipeControlThatMayBeErasedFlushesDc);
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenDcFlushDisabledInEpilogueWhenPipeControlWithDcFlushIsErasedDuringAggregationThenEpilogueFlushesDc) {
+    using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DisableDcFlushInEpilogue.set(true);
+
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
+    pDevice->resetCommandStreamReceiver(mockCsr);
+
+    mockCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatch);
+    mockCsr->timestampPacketWriteEnabled = false;
+
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.outOfOrderExecutionAllowed = true;
+
+    dispatchFlags.dcFlush = true;
+    mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    dispatchFlags.dcFlush = false;
+    mockCsr->flushTask(commandStream, commandStream.getUsed(), dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+
+    auto &cmdBufferList = mockCsr->peekSubmissionAggregator()->peekCmdBufferList();
+    auto firstEpilogue = cmdBufferList.peekHead()->epiloguePipeControlLocation;
+    auto lastEpilogue = reinterpret_cast<PIPE_CONTROL *>(cmdBufferList.peekTail()->epiloguePipeControlLocation);
+
+    mockCsr->flushBatchedSubmissions();
+
+    auto &aggregationStatistics = mockCsr->peekSubmissionAggregator()->getAggregationStatistics();
+    EXPECT_EQ(2u, aggregationStatistics.commandBuffersCount);
+    EXPECT_EQ(1u, aggregationStatistics.submissionsCount);
+    EXPECT_EQ(1u, aggregationStatistics.erasedPipeControlsCount);
+
+    auto pipeControlSize = MemorySynchronizationCommands<FamilyType>::getSizeForPipeControlWithPostSyncOperation(pDevice->getHardwareInfo());
+    auto zeros = std::make_unique<uint8_t[]>(pipeControlSize);
+    memset(zeros.get(), 0, pipeControlSize);
+    EXPECT_EQ(0, memcmp(firstEpilogue, zeros.get(), pipeControlSize));
+    EXPECT_TRUE(lastEpilogue->getDcFlushEnable());
+}
+
 HWTEST_F(CommandStreamReceiverFlushTaskTests, givenEpiloguePipeControlThenDcFlushIsEnabled) {
     using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
 
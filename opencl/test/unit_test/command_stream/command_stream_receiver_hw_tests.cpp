@@ -11,7 +11,9 @@
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/command_stream/scratch_space_controller.h"
 #include "shared/source/command_stream/scratch_space_controller_base.h"
+#include "shared/source/command_stream/scratch_space_pool.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/cache_policy.h"
 #include "shared/source/helpers/preamble.h"
@@ -2176,6 +2178,7 @@ HWTEST_F(BcsTests, givenInvalidBlitDirectionWhenConstructPropertiesThenException
 
 struct MockScratchSpaceController : ScratchSpaceControllerBase {
     using ScratchSpaceControllerBase::privateScratchAllocation;
+    using ScratchSpaceControllerBase::scratchSizeBytes;
     using ScratchSpaceControllerBase::ScratchSpaceControllerBase;
 };
 
@@ -2188,6 +2191,64 @@ TEST_F(ScratchSpaceControllerTest, whenScratchSpaceControllerIsDestroyedThenItRe
     //no memory leak is expected
 }
 
+TEST(ScratchSpacePoolTest, whenGettingSizeClassThenRequiredSizeIsRoundedUpToPowerOfTwoAndMinimalSizeClass) {
+    EXPECT_EQ(ScratchSpacePool::minimalSizeClass, ScratchSpacePool::getSizeClass(1u));
+    EXPECT_EQ(ScratchSpacePool::minimalSizeClass, ScratchSpacePool::getSizeClass(ScratchSpacePool::minimalSizeClass));
+    EXPECT_EQ(4 * MemoryConstants::megaByte, ScratchSpacePool::getSizeClass(3 * MemoryConstants::megaByte));
+    EXPECT_EQ(4 * MemoryConstants::megaByte, ScratchSpacePool::getSizeClass(4 * MemoryConstants::megaByte));
+}
+
+TEST_F(ScratchSpaceControllerTest, givenScratchSpacePoolWhenScratchSpaceGrowsThenPreviousAllocationIsReusedByOtherController) {
+    auto &csr = pDevice->getGpgpuCommandStreamReceiver();
+    auto &rootDeviceEnvironment = *pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()];
+    rootDeviceEnvironment.scratchSpacePool = std::make_unique<ScratchSpacePool>(*pDevice->getMemoryManager());
+    auto scratchSpacePool = rootDeviceEnvironment.scratchSpacePool.get();
+
+    bool stateBaseAddressDirty = false;
+    bool vfeStateDirty = false;
+    {
+        MockScratchSpaceController scratchSpaceController(pDevice->getRootDeviceIndex(), *pDevice->getExecutionEnvironment(), *csr.getInternalAllocationStorage());
+        scratchSpaceController.setRequiredScratchSpace(nullptr, 0x1000u, 0u, 0u, csr.getOsContext(), stateBaseAddressDirty, vfeStateDirty);
+        auto firstAllocation = scratchSpaceController.getScratchSpaceAllocation();
+        ASSERT_NE(nullptr, firstAllocation);
+        EXPECT_TRUE(Math::isPow2(scratchSpaceController.scratchSizeBytes));
+        EXPECT_EQ(0u, scratchSpaceController.getScratchReallocationsCount());
+
+        scratchSpaceController.setRequiredScratchSpace(nullptr, 0x1000u, 0u, 0u, csr.getOsContext(), stateBaseAddressDirty, vfeStateDirty);
+        EXPECT_EQ(firstAllocation, scratchSpaceController.getScratchSpaceAllocation());
+        EXPECT_EQ(0u, scratchSpaceController.getScratchReallocationsCount());
+
+        scratchSpaceController.setRequiredScratchSpace(nullptr, 0x4000u, 0u, 0u, csr.getOsContext(), stateBaseAddressDirty, vfeStateDirty);
+        EXPECT_NE(firstAllocation, scratchSpaceController.getScratchSpaceAllocation());
+        EXPECT_EQ(1u, scratchSpaceController.getScratchReallocationsCount());
+        EXPECT_EQ(1u, scratchSpacePool->getPooledAllocationsCount());
+
+        MockScratchSpaceController otherScratchSpaceController(pDevice->getRootDeviceIndex(), *pDevice->getExecutionEnvironment(), *csr.getInternalAllocationStorage());
+        otherScratchSpaceController.setRequiredScratchSpace(nullptr, 0x800u, 0u, 0u, csr.getOsContext(), stateBaseAddressDirty, vfeStateDirty);
+        EXPECT_EQ(firstAllocation, otherScratchSpaceController.getScratchSpaceAllocation());
+        EXPECT_EQ(firstAllocation->getUnderlyingBufferSize(), otherScratchSpaceController.scratchSizeBytes);
+        EXPECT_EQ(0u, scratchSpacePool->getPooledAllocationsCount());
+        EXPECT_EQ(1u, scratchSpacePool->getReusedAllocationsCount());
+    }
+    rootDeviceEnvironment.scratchSpacePool.reset();
+}
+
+TEST_F(ScratchSpaceControllerTest, givenScratchSpacePoolWithBusyAllocationWhenObtainingAllocationThenNothingIsReturned) {
+    auto &csr = pDevice->getGpgpuCommandStreamReceiver();
+    ScratchSpacePool scratchSpacePool(*pDevice->getMemoryManager());
+
+    auto allocation = pDevice->getMemoryManager()->allocateGraphicsMemoryWithProperties({pDevice->getRootDeviceIndex(), ScratchSpacePool::minimalSizeClass, GraphicsAllocation::AllocationType::SCRATCH_SURFACE, pDevice->getDeviceBitfield()});
+    allocation->updateTaskCount(*csr.getTagAddress() + 1, csr.getOsContext().getContextId());
+    scratchSpacePool.releaseAllocation(allocation, pDevice->getDeviceBitfield());
+
+    EXPECT_EQ(nullptr, scratchSpacePool.obtainAllocation(ScratchSpacePool::minimalSizeClass, pDevice->getDeviceBitfield()));
+
+    allocation->updateTaskCount(*csr.getTagAddress(), csr.getOsContext().getContextId());
+    EXPECT_EQ(nullptr, scratchSpacePool.obtainAllocation(2 * ScratchSpacePool::minimalSizeClass, pDevice->getDeviceBitfield()));
+    EXPECT_EQ(allocation, scratchSpacePool.obtainAllocation(ScratchSpacePool::minimalSizeClass, pDevice->getDeviceBitfield()));
+    pDevice->getMemoryManager()->freeGraphicsMemory(allocation);
+}
+
 TEST(BcsConstantsTests, givenBlitConstantsThenTheyHaveDesiredValues) {
     EXPECT_EQ(BlitterConstants::maxBlitWidth, 0x3FC0u);
     EXPECT_EQ(BlitterConstants::maxBlitHeight, 0x3FC0u);
@@ -101,6 +101,16 @@ TEST_F(LinearStreamTest, WhenReplacingBufferThenAvailableSizeIsEqualToBufferSize
     EXPECT_EQ(0u, linearStream.getUsed());
 }
 
+TEST_F(LinearStreamTest, WhenReplacingBufferThenBufferGenerationIsChangedAndUniqueAcrossStreams) {
+    char buffer[256];
+    auto generation = linearStream.getBufferGeneration();
+    linearStream.replaceBuffer(buffer, sizeof(buffer));
+    EXPECT_NE(generation, linearStream.getBufferGeneration());
+
+    LinearStream otherStream(buffer, sizeof(buffer));
+    EXPECT_NE(linearStream.getBufferGeneration(), otherStream.getBufferGeneration());
+}
+
 TEST_F(LinearStreamTest, givenNewGraphicsAllocationWhenReplaceIsCalledThenLinearStreamContainsNewGraphicsAllocation) {
     auto graphicsAllocation = linearStream.getGraphicsAllocation();
     EXPECT_NE(nullptr, graphicsAllocation);
@@ -574,6 +574,46 @@ TEST(SubmissionsAggregator, givenCommandBuffersRequiringDifferentSliceCountSetti
     EXPECT_EQ(1u, cmdBuffer->inspectionId);
 }
 
+TEST(SubmissionsAggregator, givenThirdCommandBufferRequiringDifferentCoherencySettingWhenAggregateIsCalledThenOnlyFirstTwoAreAggregated) {
+    MockSubmissionAggregator submissionsAggregator;
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    CommandBuffer *cmdBuffer = new CommandBuffer(*device);
+    CommandBuffer *cmdBuffer2 = new CommandBuffer(*device);
+    CommandBuffer *cmdBuffer3 = new CommandBuffer(*device);
+
+    MockGraphicsAllocation alloc1(nullptr, 1);
+    MockGraphicsAllocation alloc3(nullptr, 3);
+    MockGraphicsAllocation alloc7(nullptr, 7);
+
+    cmdBuffer3->batchBuffer.requiresCoherency = true;
+
+    cmdBuffer->surfaces.push_back(&alloc1);
+    cmdBuffer2->surfaces.push_back(&alloc3);
+    cmdBuffer3->surfaces.push_back(&alloc7);
+
+    submissionsAggregator.recordCommandBuffer(cmdBuffer);
+    submissionsAggregator.recordCommandBuffer(cmdBuffer2);
+    submissionsAggregator.recordCommandBuffer(cmdBuffer3);
+
+    ResourcePackage resourcePackage;
+    size_t totalUsedSize = 0;
+    size_t totalMemoryBudget = 200;
+    submissionsAggregator.aggregateCommandBuffers(resourcePackage, totalUsedSize, totalMemoryBudget, 0u);
+    EXPECT_EQ(4u, totalUsedSize);
+    EXPECT_EQ(2u, resourcePackage.size());
+    EXPECT_EQ(cmdBuffer->inspectionId, cmdBuffer2->inspectionId);
+    EXPECT_NE(cmdBuffer->inspectionId, cmdBuffer3->inspectionId);
+
+    auto &aggregationStatistics = submissionsAggregator.getAggregationStatistics();
+    EXPECT_EQ(2u, aggregationStatistics.commandBuffersCount);
+    EXPECT_EQ(1u, aggregationStatistics.submissionsCount);
+
+    submissionsAggregator.resetAggregationStatistics();
+    EXPECT_EQ(0u, aggregationStatistics.commandBuffersCount);
+    EXPECT_EQ(0u, aggregationStatistics.submissionsCount);
+}
+
 struct SubmissionsAggregatorTests : public ::testing::Test {
     void SetUp() override {
         device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
@@ -411,6 +411,96 @@ HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, givenKernelWithFourBindingTabl
     }
 }
 
+HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, givenIndirectDataReuseEnabledWhenKernelWithUnchangedCrossThreadDataIsSentAgainThenPreviousIndirectDataIsReused) {
+    using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableIndirectDataReuse.set(1);
+
+    CommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, 0, false);
+    auto &commandStream = cmdQ.getCS(1024);
+    auto &dsh = cmdQ.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 8192);
+    auto &ioh = cmdQ.getIndirectHeap(IndirectHeap::INDIRECT_OBJECT, 8192);
+    auto &ssh = cmdQ.getIndirectHeap(IndirectHeap::SURFACE_STATE, 8192);
+    auto &kernel = *mockKernelWithInternal->mockKernel;
+    const size_t localWorkSizes[3]{256, 1, 1};
+    uint32_t interfaceDescriptorIndex = 0;
+    auto isCcsUsed = EngineHelpers::isCcs(cmdQ.getGpgpuEngine().osContext->getEngineType());
+    auto kernelUsesLocalIds = HardwareCommandsHelper<FamilyType>::kernelUsesLocalIds(kernel);
+
+    auto sendIndirectState = [&](GPGPU_WALKER *pWalkerCmd) {
+        *pWalkerCmd = FamilyType::cmdInitGpgpuWalker;
+        return HardwareCommandsHelper<FamilyType>::sendIndirectState(
+            commandStream,
+            dsh,
+            ioh,
+            ssh,
+            kernel,
+            kernel.getKernelStartOffset(true, kernelUsesLocalIds, isCcsUsed),
+            kernel.getKernelInfo().getMaxSimdSize(),
+            localWorkSizes,
+            0,
+            interfaceDescriptorIndex,
+            pDevice->getPreemptionMode(),
+            pWalkerCmd,
+            nullptr,
+            true);
+    };
+
+    GPGPU_WALKER firstWalker;
+    auto firstOffset = sendIndirectState(&firstWalker);
+    auto iohUsedAfterFirstDispatch = ioh.getUsed();
+
+    GPGPU_WALKER secondWalker;
+    auto secondOffset = sendIndirectState(&secondWalker);
+    EXPECT_EQ(firstOffset, secondOffset);
+    EXPECT_EQ(iohUsedAfterFirstDispatch, ioh.getUsed());
+    EXPECT_EQ(firstWalker.getIndirectDataStartAddress(), secondWalker.getIndirectDataStartAddress());
+    EXPECT_EQ(firstWalker.getIndirectDataLength(), secondWalker.getIndirectDataLength());
+
+    kernel.getCrossThreadData()[0]++;
+    GPGPU_WALKER thirdWalker;
+    auto thirdOffset = sendIndirectState(&thirdWalker);
+    EXPECT_NE(firstOffset, thirdOffset);
+    EXPECT_LT(iohUsedAfterFirstDispatch, ioh.getUsed());
+    EXPECT_EQ(0, memcmp(ptrOffset(ioh.getCpuBase(), thirdOffset - static_cast<size_t>(ioh.getHeapGpuStartOffset())),
+                        kernel.getCrossThreadData(), kernel.getCrossThreadDataSize()));
+}
+
+HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, givenIndirectDataReuseDisabledWhenKernelIsSentAgainThenIndirectDataIsCopiedAgain) {
+    using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
+    CommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, 0, false);
+    auto &commandStream = cmdQ.getCS(1024);
+    auto &dsh = cmdQ.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 8192);
+    auto &ioh = cmdQ.getIndirectHeap(IndirectHeap::INDIRECT_OBJECT, 8192);
+    auto &ssh = cmdQ.getIndirectHeap(IndirectHeap::SURFACE_STATE, 8192);
+    auto &kernel = *mockKernelWithInternal->mockKernel;
+    const size_t localWorkSizes[3]{256, 1, 1};
+    uint32_t interfaceDescriptorIndex = 0;
+    auto isCcsUsed = EngineHelpers::isCcs(cmdQ.getGpgpuEngine().osContext->getEngineType());
+    auto kernelUsesLocalIds = HardwareCommandsHelper<FamilyType>::kernelUsesLocalIds(kernel);
+
+    size_t offsets[2] = {};
+    for (auto &offset : offsets) {
+        GPGPU_WALKER walkerCmd = FamilyType::cmdInitGpgpuWalker;
+        offset = HardwareCommandsHelper<FamilyType>::sendIndirectState(
+            commandStream,
+            dsh,
+            ioh,
+            ssh,
+            kernel,
+            kernel.getKernelStartOffset(true, kernelUsesLocalIds, isCcsUsed),
+            kernel.getKernelInfo().getMaxSimdSize(),
+            localWorkSizes,
+            0,
+            interfaceDescriptorIndex,
+            pDevice->getPreemptionMode(),
+            &walkerCmd,
+            nullptr,
+            true);
+    }
+    EXPECT_NE(offsets[0], offsets[1]);
+}
+
 HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, givenKernelThatIsSchedulerWhenIndirectStateIsEmittedThenInterfaceDescriptorContainsZeroBindingTableEntryCount) {
     using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
     using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/cpu_info.h"
+
+#include "opencl/source/helpers/pitched_copy.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace NEO;
+
+using CopyRowsFunction = void (*)(void *dst, size_t dstRowPitch, const void *src, size_t srcRowPitch, size_t rowSize, size_t rowsCount);
+
+struct PitchedCopyTest : public ::testing::TestWithParam<size_t> {
+    void verifyCopyRows(CopyRowsFunction copyRowsFunction, size_t dstRowPitch, size_t srcRowPitch, size_t rowSize, size_t rowsCount) {
+        std::vector<uint8_t> src(srcRowPitch * rowsCount + 1);
+        std::vector<uint8_t> dst(dstRowPitch * rowsCount + 1);
+        for (size_t i = 0; i < src.size(); i++) {
+            src[i] = static_cast<uint8_t>(i * 13 + 5);
+        }
+        std::vector<uint8_t> expected(dst.size());
+        for (size_t row = 0; row < rowsCount; row++) {
+            memcpy(expected.data() + row * dstRowPitch, src.data() + row * srcRowPitch, rowSize);
+        }
+
+        copyRowsFunction(dst.data(), dstRowPitch, src.data(), srcRowPitch, rowSize, rowsCount);
+        EXPECT_EQ(expected, dst);
+    }
+
+    void verifyCopyRows(CopyRowsFunction copyRowsFunction) {
+        size_t rowSize = GetParam();
+        verifyCopyRows(copyRowsFunction, rowSize + 7, rowSize + 3, rowSize, 5);
+        verifyCopyRows(copyRowsFunction, rowSize, rowSize + 64, rowSize, 3);
+        verifyCopyRows(copyRowsFunction, rowSize, rowSize, rowSize, 4);
+    }
+};
+
+TEST_P(PitchedCopyTest, givenRowsWithPitchWhenCopyingWithMemcpyThenOnlyRowsAreCopied) {
+    verifyCopyRows(copyRowsWithMemcpy);
+}
+
+TEST_P(PitchedCopyTest, givenRowsWithPitchWhenCopyingWithSse4ThenOnlyRowsAreCopied) {
+    verifyCopyRows(copyRowsSimd<uint8x16_t>);
+}
+
+TEST_P(PitchedCopyTest, givenRowsWithPitchWhenCopyingWithAvx2ThenOnlyRowsAreCopied) {
+    if (!CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2)) {
+        GTEST_SKIP();
+    }
+    verifyCopyRows(copyRowsSimd<uint8x32_t>);
+}
+
+TEST_P(PitchedCopyTest, givenRowsWithPitchWhenCopyingWithSelectedFunctionThenOnlyRowsAreCopied) {
+    verifyCopyRows(PitchedCopyHelper::copyRows);
+}
+
+INSTANTIATE_TEST_CASE_P(PitchedCopy,
+                        PitchedCopyTest,
+                        ::testing::Values(1u, 4u, 15u, 16u, 17u, 31u, 32u, 33u, 48u, 100u, 512u, 513u, 4096u));
+
+TEST(PitchedCopyHelperTest, givenCpuWithAvx2WhenCheckingSelectedFunctionThenAvx2VersionIsUsed) {
+    bool supportsAVX2 = CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2);
+    CopyRowsFunction expectedFunction = supportsAVX2 ? copyRowsSimd<uint8x32_t> : copyRowsSimd<uint8x16_t>;
+    EXPECT_EQ(expectedFunction, PitchedCopyHelper::copyRows);
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/utilities/cpu_info.h"
+
+#include "opencl/source/helpers/uint16_avx512.h"
+
+#include "gtest/gtest.h"
+
+#if __AVX512BW__
+using namespace NEO;
+
+struct Uint16Avx512 : public ::testing::Test {
+    void SetUp() override {
+        if (!CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX512F | CpuInfo::featureAvX512Bw)) {
+            GTEST_SKIP();
+        }
+    }
+};
+
+TEST_F(Uint16Avx512, GivenMaskWhenCastingToBoolThenTrueIsReturned) {
+    EXPECT_TRUE(static_cast<bool>(uint16x32_t::mask()));
+}
+
+TEST_F(Uint16Avx512, GivenZeroWhenCastingToBoolThenFalseIsReturned) {
+    EXPECT_FALSE(static_cast<bool>(uint16x32_t::zero()));
+}
+
+TEST_F(Uint16Avx512, WhenConjoiningMaskAndZeroThenBooleanResultIsCorrect) {
+    EXPECT_TRUE(uint16x32_t::mask() && uint16x32_t::mask());
+    EXPECT_FALSE(uint16x32_t::mask() && uint16x32_t::zero());
+    EXPECT_FALSE(uint16x32_t::zero() && uint16x32_t::mask());
+    EXPECT_FALSE(uint16x32_t::zero() && uint16x32_t::zero());
+}
+
+TEST_F(Uint16Avx512, GivenOneWhenCreatingThenInstancesAreSame) {
+    auto one = uint16x32_t::one();
+    uint16x32_t alsoOne(one.value);
+    EXPECT_EQ(0, memcmp(&alsoOne, &one, sizeof(uint16x32_t)));
+}
+
+TEST_F(Uint16Avx512, GivenValueWhenCreatingThenConstructorIsReplicated) {
+    uint16x32_t allSevens(7u);
+    for (int i = 0; i < uint16x32_t::numChannels; ++i) {
+        EXPECT_EQ(7u, allSevens.get(i));
+    }
+}
+
+ALIGNAS(64)
+static const uint16_t laneValues[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63};
+
+TEST_F(Uint16Avx512, GivenArrayWhenCreatingThenConstructorIsReplicated) {
+    uint16x32_t lanes(laneValues);
+    for (int i = 0; i < uint16x32_t::numChannels; ++i) {
+        EXPECT_EQ(static_cast<uint16_t>(i), lanes.get(i));
+    }
+}
+
+TEST_F(Uint16Avx512, WhenLoadingThenValuesAreSetCorrectly) {
+    uint16x32_t lanes;
+    lanes.load(laneValues);
+    for (int i = 0; i < uint16x32_t::numChannels; ++i) {
+        EXPECT_EQ(static_cast<uint16_t>(i), lanes.get(i));
+    }
+}
+
+TEST_F(Uint16Avx512, WhenLoadingUnalignedThenValuesAreSetCorrectly) {
+    uint16x32_t lanes;
+    lanes.loadUnaligned(laneValues + 1);
+    for (int i = 0; i < uint16x32_t::numChannels; ++i) {
+        EXPECT_EQ(static_cast<uint16_t>(i + 1), lanes.get(i));
+    }
+}
+
+TEST_F(Uint16Avx512, WhenStoringThenValuesAreSetCorrectly) {
+    uint16_t *alignedMemory = reinterpret_cast<uint16_t *>(alignedMalloc(1024, 64));
+
+    uint16x32_t lanes(laneValues);
+    lanes.store(alignedMemory);
+    for (int i = 0; i < uint16x32_t::numChannels; ++i) {
+        EXPECT_EQ(static_cast<uint16_t>(i), alignedMemory[i]);
+    }
+
+    alignedFree(alignedMemory);
+}
+
+TEST_F(Uint16Avx512, GivenMemoryAlignedToHalfOfVectorWhenStoringThenValuesAreSetCorrectly) {
+    uint16_t *alignedMemory = reinterpret_cast<uint16_t *>(alignedMalloc(1024, 64));
+    auto halfAlignedMemory = alignedMemory + 16;
+
+    uint16x32_t lanes(laneValues);
+    lanes.store(halfAlignedMemory);
+    for (int i = 0; i < uint16x32_t::numChannels; ++i) {
+        EXPECT_EQ(static_cast<uint16_t>(i), halfAlignedMemory[i]);
+    }
+
+    alignedFree(alignedMemory);
+}
+
+TEST_F(Uint16Avx512, WhenStoringUnalignedThenValuesAreSetCorrectly) {
+    uint16_t *alignedMemory = reinterpret_cast<uint16_t *>(alignedMalloc(1024, 64));
+
+    uint16x32_t lanes(laneValues);
+    lanes.storeUnaligned(alignedMemory + 1);
+    for (int i = 0; i < uint16x32_t::numChannels; ++i) {
+        EXPECT_EQ(static_cast<uint16_t>(i), (alignedMemory + 1)[i]);
+    }
+
+    alignedFree(alignedMemory);
+}
+
+TEST_F(Uint16Avx512, WhenDecrementingThenValuesAreSetCorrectly) {
+    uint16x32_t result(laneValues);
+    result -= uint16x32_t::one();
+
+    for (int i = 0; i < uint16x32_t::numChannels; ++i) {
+        EXPECT_EQ(static_cast<uint16_t>(i - 1), result.get(i));
+    }
+}
+
+TEST_F(Uint16Avx512, WhenIncrementingThenValuesAreSetCorrectly) {
+    uint16x32_t result(laneValues);
+    result += uint16x32_t::one();
+
+    for (int i = 0; i < uint16x32_t::numChannels; ++i) {
+        EXPECT_EQ(static_cast<uint16_t>(i + 1), result.get(i));
+    }
+}
+
+TEST_F(Uint16Avx512, WhenComparingThenMaskIsSetForLanesGreaterOrEqual) {
+    uint16x32_t lanes(laneValues);
+    auto result = lanes >= uint16x32_t(static_cast<uint16_t>(16u));
+
+    for (int i = 0; i < uint16x32_t::numChannels; ++i) {
+        EXPECT_EQ(i >= 16 ? 0xffffu : 0u, result.get(i));
+    }
+}
+
+TEST_F(Uint16Avx512, WhenBlendingThenValuesAreSetCorrectly) {
+    uint16x32_t a(uint16x32_t::one());
+    uint16x32_t b(uint16x32_t::zero());
+    uint16x32_t c;
+
+    // c = mask ? a : b
+    c = blend(a, b, uint16x32_t::mask());
+
+    for (int i = 0; i < uint16x32_t::numChannels; ++i) {
+        EXPECT_EQ(a.get(i), c.get(i));
+    }
+
+    // c = mask ? a : b
+    c = blend(a, b, uint16x32_t::zero());
+
+    for (int i = 0; i < uint16x32_t::numChannels; ++i) {
+        EXPECT_EQ(b.get(i), c.get(i));
+    }
+}
+
+TEST_F(Uint16Avx512, GivenPartialMaskWhenBlendingThenEachLaneIsSelectedSeparately) {
+    uint16x32_t a(laneValues);
+    uint16x32_t b(static_cast<uint16_t>(0xabcdu));
+    auto mask = a >= uint16x32_t(static_cast<uint16_t>(16u));
+
+    auto c = blend(a, b, mask);
+
+    for (int i = 0; i < uint16x32_t::numChannels; ++i) {
+        EXPECT_EQ(i >= 16 ? a.get(i) : b.get(i), c.get(i));
+    }
+}
+#endif // __AVX512BW__
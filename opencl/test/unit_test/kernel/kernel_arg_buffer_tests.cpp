@@ -5,6 +5,9 @@
  *
  */
 
+#include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/helpers/bindless_heaps_helper.h"
+#include "shared/source/helpers/hw_helper.h"
 #include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "opencl/source/kernel/kernel.h"
@@ -14,6 +17,7 @@
 #include "opencl/test/unit_test/fixtures/memory_management_fixture.h"
 #include "opencl/test/unit_test/kernel/kernel_arg_buffer_fixture.h"
 #include "opencl/test/unit_test/mocks/mock_buffer.h"
+#include "opencl/test/unit_test/mocks/mock_command_queue.h"
 #include "opencl/test/unit_test/mocks/mock_context.h"
 #include "opencl/test/unit_test/mocks/mock_kernel.h"
 #include "opencl/test/unit_test/mocks/mock_program.h"
@@ -23,7 +27,9 @@
 #include "gtest/gtest.h"
 #include "hw_cmds.h"
 
+#include <atomic>
 #include <memory>
+#include <thread>
 
 using namespace NEO;
 
@@ -289,4 +295,132 @@ HWTEST_F(KernelArgBufferTest, givenUsedBindlessBuffersAndBuiltinKernelWhenPatchi
     uint32_t sshOffset = 0x1000;
     pKernel->patchBindlessSurfaceStateOffsets(sshOffset);
     EXPECT_EQ(0xdeadu, *patchLocation);
-}
\ No newline at end of file
+}
+
+HWTEST_F(KernelArgBufferTest, givenGlobalBindlessHeapWhenBufferIsSetAsArgThenOffsetOfBufferSurfaceStateInGlobalHeapIsPatched) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UseBindlessBuffers.set(1);
+
+    auto &hwHelper = HwHelper::get(pDevice->getHardwareInfo().platform.eRenderCoreFamily);
+    auto &rootDeviceEnvironment = *pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()];
+    rootDeviceEnvironment.bindlessHeapsHelper = std::make_unique<BindlessHeapsHelper>(pDevice->getMemoryManager(), pDevice->getRootDeviceIndex(),
+                                                                                      pDevice->getDeviceBitfield(), hwHelper.getRenderSurfaceStateSize());
+    auto bindlessHeapsHelper = rootDeviceEnvironment.bindlessHeapsHelper.get();
+
+    auto crossThreadDataOffset = pKernelInfo->kernelArgInfo[0].kernelArgPatchInfoVector[0].crossthreadOffset;
+    pKernelInfo->kernelArgInfo[0].offsetHeap = 0;
+    pKernelInfo->kernelArgInfo[0].isBuffer = true;
+    auto patchLocation = reinterpret_cast<uint32_t *>(ptrOffset(pKernel->getCrossThreadData(), crossThreadDataOffset));
+
+    {
+        MockBuffer buffer;
+        auto val = static_cast<cl_mem>(&buffer);
+        EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem), &val));
+        EXPECT_EQ(1u, bindlessHeapsHelper->getUsedSlotsCount());
+
+        auto globalOffset = pKernel->kernelArguments[0].globalBindlessSurfaceStateOffset;
+        ASSERT_TRUE(isValidOffset(globalOffset));
+        auto surfaceStateInHeap = ptrOffset(bindlessHeapsHelper->getHeapAllocation()->getUnderlyingBuffer(), globalOffset);
+        EXPECT_EQ(0, memcmp(surfaceStateInHeap, pKernel->getSurfaceStateHeap(), hwHelper.getRenderSurfaceStateSize()));
+
+        EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem), &val));
+        EXPECT_EQ(globalOffset, pKernel->kernelArguments[0].globalBindlessSurfaceStateOffset);
+        EXPECT_EQ(1u, bindlessHeapsHelper->getUsedSlotsCount());
+
+        *patchLocation = 0xdead;
+        pKernel->patchBindlessSurfaceStateOffsets(0x1000);
+        EXPECT_EQ(hwHelper.getBindlessSurfaceExtendedMessageDescriptorValue(globalOffset), *patchLocation);
+    }
+    EXPECT_EQ(0u, bindlessHeapsHelper->getUsedSlotsCount());
+
+    rootDeviceEnvironment.bindlessHeapsHelper.reset();
+}
+
+HWTEST_F(KernelArgBufferTest, givenGlobalBindlessHeapWhenSurfaceStateOfNonBufferArgChangesThenKernelReplacesItsOwnedSlot) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UseBindlessBuffers.set(1);
+
+    auto &hwHelper = HwHelper::get(pDevice->getHardwareInfo().platform.eRenderCoreFamily);
+    auto &rootDeviceEnvironment = *pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()];
+    rootDeviceEnvironment.bindlessHeapsHelper = std::make_unique<BindlessHeapsHelper>(pDevice->getMemoryManager(), pDevice->getRootDeviceIndex(),
+                                                                                      pDevice->getDeviceBitfield(), hwHelper.getRenderSurfaceStateSize());
+    auto bindlessHeapsHelper = rootDeviceEnvironment.bindlessHeapsHelper.get();
+    auto surfaceStateSize = hwHelper.getRenderSurfaceStateSize();
+
+    auto crossThreadDataOffset = pKernelInfo->kernelArgInfo[0].kernelArgPatchInfoVector[0].crossthreadOffset;
+    pKernelInfo->kernelArgInfo[0].offsetHeap = 0;
+    pKernelInfo->kernelArgInfo[0].isBuffer = true;
+    auto patchLocation = reinterpret_cast<uint32_t *>(ptrOffset(pKernel->getCrossThreadData(), crossThreadDataOffset));
+    auto kernelSurfaceState = reinterpret_cast<uint8_t *>(pKernel->getSurfaceStateHeap());
+
+    for (uint8_t pattern = 1; pattern <= 3; pattern++) {
+        memset(kernelSurfaceState, pattern, surfaceStateSize);
+        pKernel->patchBindlessSurfaceStateOffsets(0x1000);
+        EXPECT_EQ(1u, bindlessHeapsHelper->getUsedSlotsCount());
+
+        auto ownedOffset = pKernel->ownedBindlessSurfaceStates[0];
+        EXPECT_EQ(hwHelper.getBindlessSurfaceExtendedMessageDescriptorValue(ownedOffset), *patchLocation);
+        EXPECT_EQ(0, memcmp(ptrOffset(bindlessHeapsHelper->getHeapAllocation()->getUnderlyingBuffer(), ownedOffset), kernelSurfaceState, surfaceStateSize));
+    }
+
+    pKernel->ownedBindlessSurfaceStates.clear();
+    rootDeviceEnvironment.bindlessHeapsHelper.reset();
+}
+
+HWTEST_F(KernelArgBufferTest, givenGlobalBindlessHeapWhenSameKernelIsEnqueuedConcurrentlyOnTwoQueuesThenEachArgumentOwnsSingleSlot) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UseBindlessBuffers.set(1);
+
+    auto &hwHelper = HwHelper::get(pDevice->getHardwareInfo().platform.eRenderCoreFamily);
+    auto &rootDeviceEnvironment = *pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()];
+    rootDeviceEnvironment.bindlessHeapsHelper = std::make_unique<BindlessHeapsHelper>(pDevice->getMemoryManager(), pDevice->getRootDeviceIndex(),
+                                                                                      pDevice->getDeviceBitfield(), hwHelper.getRenderSurfaceStateSize());
+    auto bindlessHeapsHelper = rootDeviceEnvironment.bindlessHeapsHelper.get();
+    auto surfaceStateSize = hwHelper.getRenderSurfaceStateSize();
+
+    {
+        MockKernelWithInternals mockKernel(*pClDevice, pContext, true);
+        mockKernel.kernelInfo.kernelArgInfo[0].isBuffer = true;
+        mockKernel.kernelInfo.kernelArgInfo[1].isBuffer = true;
+        mockKernel.kernelInfo.kernelArgInfo[1].offsetHeap = 0;
+        auto kernelSurfaceStates = reinterpret_cast<uint8_t *>(mockKernel.mockKernel->getSurfaceStateHeap());
+        memset(kernelSurfaceStates, 1, surfaceStateSize);
+        memset(kernelSurfaceStates + 64, 2, surfaceStateSize);
+
+        // queues of different engines don't serialize their enqueues on a common command stream receiver
+        cl_queue_properties lowPriorityProperties[] = {CL_QUEUE_PRIORITY_KHR, CL_QUEUE_PRIORITY_LOW_KHR, 0};
+        auto cmdQ0 = std::make_unique<MockCommandQueueHw<FamilyType>>(pContext, pClDevice, nullptr);
+        auto cmdQ1 = std::make_unique<MockCommandQueueHw<FamilyType>>(pContext, pClDevice, lowPriorityProperties);
+        ASSERT_NE(&cmdQ0->getGpgpuCommandStreamReceiver(), &cmdQ1->getGpgpuCommandStreamReceiver());
+
+        std::atomic<bool> startEnqueueProcess(false);
+        size_t gws[3] = {1, 0, 0};
+        auto enqueueCount = 20;
+
+        auto function = [&](CommandQueue *cmdQ) {
+            while (!startEnqueueProcess)
+                ;
+            for (int enqueue = 0; enqueue < enqueueCount; enqueue++) {
+                EXPECT_EQ(CL_SUCCESS, cmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr));
+            }
+        };
+
+        std::thread thread0(function, cmdQ0.get());
+        std::thread thread1(function, cmdQ1.get());
+        startEnqueueProcess = true;
+        thread0.join();
+        thread1.join();
+
+        ASSERT_EQ(2u, mockKernel.mockKernel->ownedBindlessSurfaceStates.size());
+        auto ownedOffset0 = mockKernel.mockKernel->ownedBindlessSurfaceStates[0];
+        auto ownedOffset1 = mockKernel.mockKernel->ownedBindlessSurfaceStates[1];
+        EXPECT_NE(ownedOffset0, ownedOffset1);
+        EXPECT_EQ(2u, bindlessHeapsHelper->getUsedSlotsCount());
+
+        auto heapBuffer = bindlessHeapsHelper->getHeapAllocation()->getUnderlyingBuffer();
+        EXPECT_EQ(0, memcmp(ptrOffset(heapBuffer, ownedOffset0), kernelSurfaceStates + 64, surfaceStateSize));
+        EXPECT_EQ(0, memcmp(ptrOffset(heapBuffer, ownedOffset1), kernelSurfaceStates, surfaceStateSize));
+    }
+
+    rootDeviceEnvironment.bindlessHeapsHelper.reset();
+}
@@ -17,6 +17,7 @@ using namespace NEO;
 struct MockMapOperationsHandler : public MapOperationsHandler {
     using MapOperationsHandler::isOverlapping;
     using MapOperationsHandler::mappedPointers;
+    using MapOperationsHandler::mappedRanges;
 };
 
 struct MapOperationsHandlerTests : public ::testing::Test {
@@ -74,27 +75,27 @@ TEST_F(MapOperationsHandlerTests, givenMappedPtrsWhenDoubleRemovedThenDoNothing)
 TEST_F(MapOperationsHandlerTests, givenMapInfoWhenAddedThenSetReadOnlyFlag) {
     mapFlags = CL_MAP_READ;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 }
 
@@ -104,7 +105,7 @@ TEST_F(MapOperationsHandlerTests, givenNonReadOnlyOverlappingPtrWhenAddingThenRe
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     EXPECT_TRUE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_FALSE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0));
     EXPECT_EQ(1u, mockHandler.size());
@@ -116,11 +117,106 @@ TEST_F(MapOperationsHandlerTests, givenReadOnlyOverlappingPtrWhenAddingThenRetur
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     EXPECT_FALSE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_TRUE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0));
     EXPECT_EQ(2u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
+}
+
+TEST_F(MapOperationsHandlerTests, givenReadOnlyMapsSharingPtrWhenRemovingThenRemoveOneAtATime) {
+    mapFlags = CL_MAP_READ;
+    mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
+    mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
+    EXPECT_EQ(2u, mockHandler.size());
+
+    MapInfo receivedMapInfo;
+    mockHandler.remove(mappedPtrs[0].ptr);
+    EXPECT_EQ(1u, mockHandler.size());
+    EXPECT_TRUE(mockHandler.find(mappedPtrs[0].ptr, receivedMapInfo));
+
+    mockHandler.remove(mappedPtrs[0].ptr);
+    EXPECT_EQ(0u, mockHandler.size());
+    EXPECT_FALSE(mockHandler.find(mappedPtrs[0].ptr, receivedMapInfo));
+}
+
+TEST_F(MapOperationsHandlerTests, givenLongReadOnlyMapWhenAddingWriteMapInsideItThenOverlapIsDetectedUntilLongMapIsRemoved) {
+    MemObjSizeArray size = {{1, 1, 1}};
+    MemObjOffsetArray offset = {{0, 0, 0}};
+    cl_map_flags readFlags = CL_MAP_READ;
+    cl_map_flags writeFlags = CL_MAP_WRITE;
+
+    EXPECT_TRUE(mockHandler.add(reinterpret_cast<void *>(0x1000), 0x10000, readFlags, size, offset, 0));
+    EXPECT_TRUE(mockHandler.add(reinterpret_cast<void *>(0x8000), 0x10, readFlags, size, offset, 0));
+
+    EXPECT_FALSE(mockHandler.add(reinterpret_cast<void *>(0x9000), 0x10, writeFlags, size, offset, 0));
+    EXPECT_EQ(2u, mockHandler.size());
+
+    mockHandler.remove(reinterpret_cast<void *>(0x1000));
+    EXPECT_TRUE(mockHandler.add(reinterpret_cast<void *>(0x9000), 0x10, writeFlags, size, offset, 0));
+    EXPECT_FALSE(mockHandler.add(reinterpret_cast<void *>(0x8008), 0x10, writeFlags, size, offset, 0));
+    EXPECT_EQ(2u, mockHandler.size());
+}
+
+TEST_F(MapOperationsHandlerTests, givenOverlappingReadOnlyMapsWhenRemovedThenMappedRangesAreMergedAndReleased) {
+    MemObjSizeArray size = {{1, 1, 1}};
+    MemObjOffsetArray offset = {{0, 0, 0}};
+    cl_map_flags readFlags = CL_MAP_READ;
+
+    EXPECT_TRUE(mockHandler.add(reinterpret_cast<void *>(0x1000), 0x100, readFlags, size, offset, 0));
+    EXPECT_TRUE(mockHandler.add(reinterpret_cast<void *>(0x1080), 0x100, readFlags, size, offset, 0));
+    EXPECT_TRUE(mockHandler.add(reinterpret_cast<void *>(0x1100), 0x100, readFlags, size, offset, 0));
+    EXPECT_EQ(4u, mockHandler.mappedRanges.size());
+
+    mockHandler.remove(reinterpret_cast<void *>(0x1080));
+    EXPECT_EQ(2u, mockHandler.mappedRanges.size());
+    EXPECT_EQ(1u, mockHandler.mappedRanges[0x1000]);
+    EXPECT_EQ(0u, mockHandler.mappedRanges[0x1200]);
+
+    mockHandler.remove(reinterpret_cast<void *>(0x1000));
+    mockHandler.remove(reinterpret_cast<void *>(0x1100));
+    EXPECT_EQ(0u, mockHandler.size());
+    EXPECT_TRUE(mockHandler.mappedRanges.empty());
+}
+
+TEST_F(MapOperationsHandlerTests, givenManyConcurrentSubRegionMapsWhenAddingFindingAndRemovingThenAllOperationsAreCorrect) {
+    constexpr size_t mapsCount = 10000;
+    constexpr size_t mapLength = 64;
+    uintptr_t bufferStart = 0x100000;
+    MemObjSizeArray size = {{mapLength, 1, 1}};
+    cl_map_flags writeFlags = CL_MAP_WRITE;
+
+    for (size_t i = 0; i < mapsCount; i++) {
+        MemObjOffsetArray offset = {{i * mapLength, 0, 0}};
+        auto ptr = reinterpret_cast<void *>(bufferStart + i * mapLength * 2);
+        EXPECT_TRUE(mockHandler.add(ptr, mapLength, writeFlags, size, offset, 0));
+    }
+    EXPECT_EQ(mapsCount, mockHandler.size());
+
+    for (size_t i = 0; i < mapsCount; i++) {
+        auto ptr = reinterpret_cast<void *>(bufferStart + i * mapLength * 2);
+        MapInfo receivedMapInfo;
+        EXPECT_TRUE(mockHandler.find(ptr, receivedMapInfo));
+        EXPECT_EQ(ptr, receivedMapInfo.ptr);
+        EXPECT_EQ(i * mapLength, receivedMapInfo.offset[0]);
+
+        MapInfo overlappingMapInfo(ptrOffset(ptr, mapLength / 2), mapLength, size, {{0, 0, 0}}, 0);
+        EXPECT_TRUE(mockHandler.isOverlapping(overlappingMapInfo));
+    }
+
+    MapInfo gapMapInfo(reinterpret_cast<void *>(bufferStart + mapLength + 1), mapLength - 2, size, {{0, 0, 0}}, 0);
+    EXPECT_FALSE(mockHandler.isOverlapping(gapMapInfo));
+
+    for (size_t i = 0; i < mapsCount; i += 2) {
+        mockHandler.remove(reinterpret_cast<void *>(bufferStart + i * mapLength * 2));
+    }
+    EXPECT_EQ(mapsCount / 2, mockHandler.size());
+
+    for (size_t i = 0; i < mapsCount; i++) {
+        auto ptr = reinterpret_cast<void *>(bufferStart + i * mapLength * 2);
+        MapInfo receivedMapInfo;
+        EXPECT_EQ(i % 2 == 1, mockHandler.find(ptr, receivedMapInfo));
+    }
 }
 
 const std::tuple<void *, size_t, void *, size_t, bool> overlappingCombinations[] = {
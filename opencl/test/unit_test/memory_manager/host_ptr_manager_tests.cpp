@@ -832,6 +832,53 @@ TEST_F(HostPtrManagerTest, GivenHostPtrManagerFilledWithFragmentsWhenAskedForOve
     EXPECT_NE(nullptr, fragment3);
 }
 
+TEST_F(HostPtrManagerTest, GivenFragmentsOnLowerRootDeviceIndexWhenCheckingRangeOverlappingFirstFragmentOfRootDeviceThenBiggerOverlapIsReturned) {
+    MockHostPtrManager hostPtrManager;
+    uint32_t lowerRootDeviceIndex = rootDeviceIndex - 1;
+
+    FragmentStorage fragment;
+    fragment.fragmentCpuPointer = reinterpret_cast<void *>(0x1000);
+    fragment.fragmentSize = MemoryConstants::pageSize;
+    hostPtrManager.storeFragment(lowerRootDeviceIndex, fragment);
+    fragment.fragmentCpuPointer = reinterpret_cast<void *>(0x4000);
+    hostPtrManager.storeFragment(rootDeviceIndex, fragment);
+    EXPECT_EQ(2u, hostPtrManager.getFragmentCount());
+
+    OverlapStatus overlapStatus;
+    auto overlappedFragment = hostPtrManager.getFragmentAndCheckForOverlaps(rootDeviceIndex, reinterpret_cast<void *>(0x3000), 2 * MemoryConstants::pageSize, overlapStatus);
+    EXPECT_EQ(OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT, overlapStatus);
+    EXPECT_EQ(nullptr, overlappedFragment);
+
+    overlappedFragment = hostPtrManager.getFragmentAndCheckForOverlaps(rootDeviceIndex, reinterpret_cast<void *>(0x3000), MemoryConstants::pageSize, overlapStatus);
+    EXPECT_EQ(OverlapStatus::FRAGMENT_NOT_OVERLAPING_WITH_ANY_OTHER, overlapStatus);
+    EXPECT_EQ(nullptr, overlappedFragment);
+}
+
+TEST_F(HostPtrManagerTest, GivenCheckedAllocationRequirementsWhenPopulatingFragmentsThenOverlapResultsFromCheckAreReused) {
+    MockHostPtrManager hostPtrManager;
+    MockExecutionEnvironment executionEnvironment;
+    MockMemoryManager memoryManager(executionEnvironment);
+
+    FragmentStorage fragment;
+    fragment.fragmentCpuPointer = reinterpret_cast<void *>(0x1000);
+    fragment.fragmentSize = MemoryConstants::pageSize;
+    hostPtrManager.storeFragment(rootDeviceIndex, fragment);
+
+    auto requirements = hostPtrManager.getAllocationRequirements(rootDeviceIndex, reinterpret_cast<void *>(0x1000), 2 * MemoryConstants::pageSize);
+    ASSERT_EQ(1u, requirements.requiredFragmentsCount);
+    requirements.allocationFragments[0].allocationSize = MemoryConstants::pageSize;
+    EXPECT_EQ(OverlapStatus::FRAGMENT_NOT_CHECKED, requirements.allocationFragments[0].overlapStatus);
+
+    EXPECT_EQ(RequirementsStatus::SUCCESS, hostPtrManager.checkAllocationsForOverlapping(memoryManager, &requirements));
+    EXPECT_EQ(OverlapStatus::FRAGMENT_WITH_EXACT_SIZE_AS_STORED_FRAGMENT, requirements.allocationFragments[0].overlapStatus);
+    auto storedFragment = hostPtrManager.getFragment({fragment.fragmentCpuPointer, rootDeviceIndex});
+    EXPECT_EQ(storedFragment, requirements.allocationFragments[0].overlappedFragment);
+
+    auto osStorage = hostPtrManager.populateAlreadyAllocatedFragments(requirements);
+    EXPECT_EQ(1u, osStorage.fragmentCount);
+    EXPECT_EQ(2, storedFragment->refCount);
+}
+
 using HostPtrAllocationTest = Test<MemoryManagerWithCsrFixture>;
 
 TEST_F(HostPtrAllocationTest, givenTwoAllocationsThatSharesOneFragmentWhenOneIsDestroyedThenFragmentRemains) {
@@ -270,3 +270,105 @@ TEST_F(InternalAllocationStorageTest, givenAllocationListWhenTwoThreadsCleanConc
 
     EXPECT_TRUE(csr->getTemporaryAllocations().peekIsEmpty());
 }
+
+TEST(ReusableAllocationsPoolTest, whenGettingBucketIndexThenFloorOfLog2OfSizeIsReturned) {
+    EXPECT_EQ(0u, ReusableAllocationsPool::getBucketIndex(0u));
+    EXPECT_EQ(0u, ReusableAllocationsPool::getBucketIndex(1u));
+    EXPECT_EQ(12u, ReusableAllocationsPool::getBucketIndex(MemoryConstants::pageSize));
+    EXPECT_EQ(12u, ReusableAllocationsPool::getBucketIndex(MemoryConstants::pageSize + 1));
+    EXPECT_EQ(13u, ReusableAllocationsPool::getBucketIndex(2 * MemoryConstants::pageSize));
+}
+
+struct ReusableAllocationsPoolStorageTest : public InternalAllocationStorageTest {
+    void SetUp() override {
+        InternalAllocationStorageTest::SetUp();
+        DebugManager.flags.EnableReusableAllocationsPool.set(1);
+        poolStorage = std::make_unique<InternalAllocationStorage>(*csr);
+        contextId = csr->getOsContext().getContextId();
+    }
+    void TearDown() override {
+        poolStorage.reset();
+        InternalAllocationStorageTest::TearDown();
+    }
+    GraphicsAllocation *allocate(size_t size) {
+        return memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, size, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+    }
+
+    DebugManagerStateRestore stateRestorer;
+    std::unique_ptr<InternalAllocationStorage> poolStorage;
+    uint32_t contextId = 0;
+};
+
+TEST_F(ReusableAllocationsPoolStorageTest, givenPoolEnabledWhenReusableAllocationIsStoredThenItIsKeptInPoolInsteadOfList) {
+    ASSERT_NE(nullptr, poolStorage->getReusableAllocationsPool());
+    auto allocation = allocate(MemoryConstants::pageSize);
+    poolStorage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 2u);
+
+    EXPECT_TRUE(poolStorage->getAllocationsForReuse().peekIsEmpty());
+    EXPECT_EQ(1u, poolStorage->getReusableAllocationsPool()->getAllocationsCount());
+    EXPECT_EQ(allocation->getUnderlyingBufferSize(), poolStorage->getReusableAllocationsPool()->getPooledSize());
+    EXPECT_EQ(2u, allocation->getTaskCount(contextId));
+}
+
+TEST_F(ReusableAllocationsPoolStorageTest, givenPoolEnabledWhenStoredAllocationIsStillUsedThenItCannotBeObtainedUntilCompleted) {
+    auto allocation = allocate(MemoryConstants::pageSize);
+    poolStorage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 2u);
+
+    *csr->getTagAddress() = 1u;
+    EXPECT_EQ(nullptr, poolStorage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER));
+    EXPECT_EQ(nullptr, poolStorage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::LINEAR_STREAM));
+
+    *csr->getTagAddress() = 2u;
+    auto reusedAllocation = poolStorage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(allocation, reusedAllocation.get());
+    EXPECT_TRUE(poolStorage->getReusableAllocationsPool()->isEmpty());
+    EXPECT_EQ(0u, poolStorage->getReusableAllocationsPool()->getPooledSize());
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+}
+
+TEST_F(ReusableAllocationsPoolStorageTest, givenAllocationsInDifferentBucketsWhenObtainingAllocationThenSmallestSufficientCompletedAllocationIsReturned) {
+    auto smallAllocation = allocate(MemoryConstants::pageSize);
+    auto bigAllocation = allocate(4 * MemoryConstants::pageSize);
+    auto busyAllocation = allocate(2 * MemoryConstants::pageSize);
+    *csr->getTagAddress() = 5u;
+    poolStorage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(smallAllocation), REUSABLE_ALLOCATION, 1u);
+    poolStorage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(bigAllocation), REUSABLE_ALLOCATION, 1u);
+    poolStorage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(busyAllocation), REUSABLE_ALLOCATION, 10u);
+
+    auto reusedAllocation = poolStorage->obtainReusableAllocation(2 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(bigAllocation, reusedAllocation.get());
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+
+    reusedAllocation = poolStorage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(smallAllocation, reusedAllocation.get());
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+
+    EXPECT_EQ(1u, poolStorage->getReusableAllocationsPool()->getAllocationsCount());
+}
+
+TEST_F(ReusableAllocationsPoolStorageTest, givenPoolEnabledWhenCleaningReusableAllocationListThenOnlyCompletedAllocationsAreReleased) {
+    auto completedAllocation = allocate(MemoryConstants::pageSize);
+    auto busyAllocation = allocate(MemoryConstants::pageSize);
+    poolStorage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(completedAllocation), REUSABLE_ALLOCATION, 5u);
+    poolStorage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(busyAllocation), REUSABLE_ALLOCATION, 15u);
+
+    poolStorage->cleanAllocationList(10u, REUSABLE_ALLOCATION);
+    EXPECT_EQ(1u, poolStorage->getReusableAllocationsPool()->getAllocationsCount());
+
+    *csr->getTagAddress() = 15u;
+    auto reusedAllocation = poolStorage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(busyAllocation, reusedAllocation.get());
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+}
+
+TEST_F(ReusableAllocationsPoolStorageTest, givenPoolBudgetWhenStoredAllocationsExceedItThenCompletedAllocationsAreReleased) {
+    DebugManager.flags.ReusableAllocationsPoolBudgetInMb.set(0);
+    poolStorage = std::make_unique<InternalAllocationStorage>(*csr);
+
+    *csr->getTagAddress() = 5u;
+    poolStorage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocate(MemoryConstants::pageSize)), REUSABLE_ALLOCATION, 5u);
+    EXPECT_TRUE(poolStorage->getReusableAllocationsPool()->isEmpty());
+
+    poolStorage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocate(MemoryConstants::pageSize)), REUSABLE_ALLOCATION, 6u);
+    EXPECT_EQ(1u, poolStorage->getReusableAllocationsPool()->getAllocationsCount());
+}
@@ -15,6 +15,7 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/program/program_initialization.h"
+#include "shared/source/utilities/cpu_copy_engine.h"
 #include "shared/test/unit_test/compiler_interface/linker_mock.h"
 #include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 #include "shared/test/unit_test/helpers/variable_backup.h"
@@ -1057,6 +1058,25 @@ TEST(OsAgnosticMemoryManager, givenCommonMemoryManagerWhenIsAskedIfApplicationMe
     EXPECT_FALSE(memoryManager.isMemoryBudgetExhausted());
 }
 
+TEST(OsAgnosticMemoryManager, givenDefaultFlagsWhenGettingCpuCopyEngineThenNullptrIsReturned) {
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
+    OsAgnosticMemoryManager memoryManager(executionEnvironment);
+    EXPECT_EQ(nullptr, memoryManager.getCpuCopyEngine());
+}
+
+TEST(OsAgnosticMemoryManager, givenParallelCpuCopyEnabledWhenGettingCpuCopyEngineThenSameEngineIsAlwaysReturned) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableParallelCpuCopy.set(1);
+    DebugManager.flags.ParallelCpuCopyThreads.set(2);
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
+    OsAgnosticMemoryManager memoryManager(executionEnvironment);
+
+    auto cpuCopyEngine = memoryManager.getCpuCopyEngine();
+    ASSERT_NE(nullptr, cpuCopyEngine);
+    EXPECT_EQ(1u, cpuCopyEngine->getNumWorkers());
+    EXPECT_EQ(cpuCopyEngine, memoryManager.getCpuCopyEngine());
+}
+
 class MemoryManagerWithAsyncDeleterTest : public ::testing::Test {
   public:
     MemoryManagerWithAsyncDeleterTest() : memoryManager(false, false){};
@@ -2175,7 +2195,7 @@ TEST(MemoryManagerCopyMemoryTest, givenAllocationWithNoStorageWhenCopyMemoryToAl
     MockMemoryManager memoryManager(false, false, executionEnvironment);
     uint8_t memory = 1;
     MockGraphicsAllocation invalidAllocation{nullptr, 0u};
-    EXPECT_FALSE(memoryManager.copyMemoryToAllocation(&invalidAllocation, &memory, sizeof(memory)));
+    EXPECT_FALSE(memoryManager.copyMemoryToAllocation(&invalidAllocation, 0u, &memory, sizeof(memory)));
 }
 
 TEST(MemoryManagerCopyMemoryTest, givenValidAllocationAndMemoryWhenCopyMemoryToAllocationThenDataIsCopied) {
@@ -2186,10 +2206,24 @@ TEST(MemoryManagerCopyMemoryTest, givenValidAllocationAndMemoryWhenCopyMemoryToA
     MockGraphicsAllocation allocation{allocationStorage, allocationSize};
     uint8_t memory = 1u;
     EXPECT_EQ(0u, allocationStorage[0]);
-    EXPECT_TRUE(memoryManager.copyMemoryToAllocation(&allocation, &memory, sizeof(memory)));
+    EXPECT_TRUE(memoryManager.copyMemoryToAllocation(&allocation, 0u, &memory, sizeof(memory)));
     EXPECT_EQ(memory, allocationStorage[0]);
 }
 
+TEST(MemoryManagerCopyMemoryTest, givenDestinationOffsetWhenCopyMemoryToAllocationThenDataIsCopiedAtOffset) {
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
+    MockMemoryManager memoryManager(false, false, executionEnvironment);
+    constexpr uint8_t allocationSize = 10;
+    uint8_t allocationStorage[allocationSize] = {0};
+    MockGraphicsAllocation allocation{allocationStorage, allocationSize};
+    uint8_t memory[2] = {1u, 2u};
+    EXPECT_TRUE(memoryManager.copyMemoryToAllocation(&allocation, 4u, memory, sizeof(memory)));
+    EXPECT_EQ(0u, allocationStorage[3]);
+    EXPECT_EQ(memory[0], allocationStorage[4]);
+    EXPECT_EQ(memory[1], allocationStorage[5]);
+    EXPECT_EQ(0u, allocationStorage[6]);
+}
+
 TEST_F(MemoryAllocatorTest, whenReservingAddressRangeThenExpectProperAddressAndReleaseWhenFreeing) {
     size_t size = 0x1000;
     auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), size});
@@ -64,6 +64,7 @@ class TestedDrmMemoryManager : public MemoryManagerCreate<DrmMemoryManager> {
     using DrmMemoryManager::getUserptrAlignment;
     using DrmMemoryManager::gfxPartitions;
     using DrmMemoryManager::lockResourceInLocalMemoryImpl;
+    using DrmMemoryManager::obtainUserptrFromCache;
     using DrmMemoryManager::memoryForPinBBs;
     using DrmMemoryManager::pinBBs;
     using DrmMemoryManager::pinThreshold;
@@ -71,8 +72,12 @@ class TestedDrmMemoryManager : public MemoryManagerCreate<DrmMemoryManager> {
     using DrmMemoryManager::releaseGpuRange;
     using DrmMemoryManager::setDomainCpu;
     using DrmMemoryManager::sharingBufferObjects;
+    using DrmMemoryManager::storeUserptrInCache;
     using DrmMemoryManager::supportsMultiStorageResources;
     using DrmMemoryManager::unlockResourceInLocalMemoryImpl;
+    using DrmMemoryManager::userptrCache;
+    using DrmMemoryManager::userptrCacheMaxSize;
+    using DrmMemoryManager::userptrCacheSize;
     using MemoryManager::allocateGraphicsMemoryInDevicePool;
     using MemoryManager::heapAssigner;
     using MemoryManager::registeredEngines;
@@ -592,7 +592,15 @@ MockFclOclDeviceCtx::MockFclOclDeviceCtx() = default;
 MockFclOclDeviceCtx::~MockFclOclDeviceCtx() = default;
 
 CIF::ICIF *MockFclOclDeviceCtx::Create(CIF::InterfaceId_t intId, CIF::Version_t version) {
-    return new MockFclOclDeviceCtx;
+    auto deviceCtx = new MockFclOclDeviceCtx;
+    // each created context takes the next preferred IR from the list
+    if (fclDebugVars && fclDebugVars->preferredIntermediateRepresentations &&
+        !fclDebugVars->preferredIntermediateRepresentations->empty()) {
+        auto &preferredIrs = *fclDebugVars->preferredIntermediateRepresentations;
+        deviceCtx->preferredIntermediateRepresentation = preferredIrs.front();
+        preferredIrs.erase(preferredIrs.begin());
+    }
+    return deviceCtx;
 }
 
 IGC::FclOclTranslationCtxBase *MockFclOclDeviceCtx::CreateTranslationCtxImpl(CIF::Version_t ver,
@@ -17,6 +17,7 @@
 #include <functional>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace NEO {
 
@@ -35,6 +36,7 @@ struct MockCompilerDebugVars {
     bool failCreateIgcFeWaInterface = false;
     std::string *receivedInternalOptionsOutput = nullptr;
     std::string *receivedInput = nullptr;
+    std::vector<IGC::CodeType::CodeType_t> *preferredIntermediateRepresentations = nullptr;
 
     std::string fileName;
 };
@@ -253,6 +255,11 @@ struct MockFclOclDeviceCtx : MockCIF<IGC::FclOclDeviceCtx<3>> {
                                                             IGC::CodeType::CodeType_t outType,
                                                             CIF::Builtins::BufferSimple *err) override;
 
+    IGC::CodeType::CodeType_t GetPreferredIntermediateRepresentation() override {
+        return preferredIntermediateRepresentation;
+    }
+
     uint32_t oclApiVersion = 120;
+    IGC::CodeType::CodeType_t preferredIntermediateRepresentation = IGC::CodeType::spirV;
 };
 } // namespace NEO
@@ -6,12 +6,18 @@
  */
 
 #include "shared/offline_compiler/source/ocloc_api.h"
+#include "shared/offline_compiler/source/ocloc_fatbinary.h"
 #include "shared/offline_compiler/source/offline_compiler.h"
+#include "shared/source/device_binary_format/ar/ar_decoder.h"
+#include "shared/source/device_binary_format/elf/elf_decoder.h"
+#include "shared/source/device_binary_format/elf/ocl_elf.h"
+#include "shared/source/helpers/hw_info.h"
 
 #include "environment.h"
 #include "gtest/gtest.h"
 
 #include <string>
+#include <vector>
 
 extern Environment *gEnvironment;
 
@@ -56,3 +62,118 @@ TEST(OclocApiTests, WhenArgsWithMissingFileAreGivenThenErrorMessageIsProduced) {
     EXPECT_EQ(retVal, NEO::INVALID_FILE);
     EXPECT_NE(std::string::npos, output.find("Command was: ocloc -file test_files/IDoNotExist.cl -device "s + argv[4]));
 }
+
+TEST(OclocApiTests, GivenFatbinaryBuildWithTwoJobsWhenInvokingOclocThenArchiveContainsBinaryOfEveryTarget) {
+    auto allEnabledPlatforms = NEO::getAllSupportedTargetPlatforms();
+    if (allEnabledPlatforms.size() < 2) {
+        return;
+    }
+    std::string platform0Name = NEO::hardwarePrefix[allEnabledPlatforms[0]];
+    std::string platform1Name = NEO::hardwarePrefix[allEnabledPlatforms[1]];
+    std::string devices = platform0Name + "," + platform1Name;
+    std::string inputFile = "test_files/copybuffer.cl";
+
+    const char *argv[] = {
+        "ocloc",
+        "-q",
+        "-file",
+        inputFile.c_str(),
+        "-device",
+        devices.c_str(),
+        "-j",
+        "2"};
+    unsigned int argc = sizeof(argv) / sizeof(const char *);
+
+    uint32_t numOutputs = 0u;
+    uint64_t *lenOutputs = nullptr;
+    uint8_t **dataOutputs = nullptr;
+    char **nameOutputs = nullptr;
+    int retVal = oclocInvoke(argc, argv,
+                             0, nullptr, nullptr, nullptr,
+                             0, nullptr, nullptr, nullptr,
+                             &numOutputs, &dataOutputs, &lenOutputs, &nameOutputs);
+    EXPECT_EQ(NEO::SUCCESS, retVal);
+
+    auto archiveName = NEO::OfflineCompiler::getFileNameTrunk(inputFile) + ".ar";
+    NEO::Ar::Ar archive;
+    std::string decodeErrors, decodeWarnings;
+    for (uint32_t i = 0; i < numOutputs; ++i) {
+        if (archiveName == nameOutputs[i]) {
+            archive = NEO::Ar::decodeAr(ArrayRef<const uint8_t>(dataOutputs[i], static_cast<size_t>(lenOutputs[i])), decodeErrors, decodeWarnings);
+        }
+    }
+    EXPECT_TRUE(decodeErrors.empty()) << decodeErrors;
+
+    std::string pointerSize = (sizeof(void *) == 4) ? "32." : "64.";
+    ASSERT_EQ(2u, archive.files.size());
+    EXPECT_TRUE(archive.files[0].fileName.startsWith((pointerSize + platform0Name + ".").c_str()));
+    EXPECT_TRUE(archive.files[1].fileName.startsWith((pointerSize + platform1Name + ".").c_str()));
+    for (auto &file : archive.files) {
+        EXPECT_FALSE(file.fileData.empty());
+    }
+
+    oclocFreeOutput(&numOutputs, &dataOutputs, &lenOutputs, &nameOutputs);
+}
+
+TEST(OclocApiTests, GivenFatbinaryTargetsWithDifferentPreferredIntermediateRepresentationsWhenInvokingOclocThenIrIsNotShared) {
+    auto allEnabledPlatforms = NEO::getAllSupportedTargetPlatforms();
+    if (allEnabledPlatforms.size() < 2) {
+        return;
+    }
+    std::string platform0Name = NEO::hardwarePrefix[allEnabledPlatforms[0]];
+    std::string platform1Name = NEO::hardwarePrefix[allEnabledPlatforms[1]];
+    std::string devices = platform0Name + "," + platform1Name;
+    std::string inputFile = "test_files/copybuffer.cl";
+
+    const char *argv[] = {
+        "ocloc",
+        "-q",
+        "-file",
+        inputFile.c_str(),
+        "-device",
+        devices.c_str()};
+    unsigned int argc = sizeof(argv) / sizeof(const char *);
+
+    std::vector<IGC::CodeType::CodeType_t> preferredIrs = {IGC::CodeType::spirV, IGC::CodeType::llvmBc};
+    auto fclDebugVars = gEnvironment->fclDebugVars;
+    fclDebugVars.preferredIntermediateRepresentations = &preferredIrs;
+    NEO::setFclDebugVars(fclDebugVars);
+
+    uint32_t numOutputs = 0u;
+    uint64_t *lenOutputs = nullptr;
+    uint8_t **dataOutputs = nullptr;
+    char **nameOutputs = nullptr;
+    int retVal = oclocInvoke(argc, argv,
+                             0, nullptr, nullptr, nullptr,
+                             0, nullptr, nullptr, nullptr,
+                             &numOutputs, &dataOutputs, &lenOutputs, &nameOutputs);
+    NEO::setFclDebugVars(gEnvironment->fclDebugVars);
+    EXPECT_EQ(NEO::SUCCESS, retVal);
+    EXPECT_TRUE(preferredIrs.empty());
+
+    auto archiveName = NEO::OfflineCompiler::getFileNameTrunk(inputFile) + ".ar";
+    NEO::Ar::Ar archive;
+    std::string decodeErrors, decodeWarnings;
+    for (uint32_t i = 0; i < numOutputs; ++i) {
+        if (archiveName == nameOutputs[i]) {
+            archive = NEO::Ar::decodeAr(ArrayRef<const uint8_t>(dataOutputs[i], static_cast<size_t>(lenOutputs[i])), decodeErrors, decodeWarnings);
+        }
+    }
+    EXPECT_TRUE(decodeErrors.empty()) << decodeErrors;
+    ASSERT_EQ(2u, archive.files.size());
+
+    auto getIrSectionType = [](ArrayRef<const uint8_t> deviceBinary) -> uint32_t {
+        std::string errors, warnings;
+        auto elf = NEO::Elf::decodeElf<NEO::Elf::EI_CLASS_64>(deviceBinary, errors, warnings);
+        for (auto &section : elf.sectionHeaders) {
+            if ((section.header->type == NEO::Elf::SHT_OPENCL_SPIRV) || (section.header->type == NEO::Elf::SHT_OPENCL_LLVM_BINARY)) {
+                return section.header->type;
+            }
+        }
+        return 0u;
+    };
+    EXPECT_EQ(static_cast<uint32_t>(NEO::Elf::SHT_OPENCL_SPIRV), getIrSectionType(archive.files[0].fileData));
+    EXPECT_EQ(static_cast<uint32_t>(NEO::Elf::SHT_OPENCL_LLVM_BINARY), getIrSectionType(archive.files[1].fileData));
+
+    oclocFreeOutput(&numOutputs, &dataOutputs, &lenOutputs, &nameOutputs);
+}
@@ -23,6 +23,24 @@ TEST(OclocFatBinaryRequestedFatBinary, WhenDeviceArgMissingThenReturnsFalse) {
     EXPECT_FALSE(NEO::requestedFatBinary(4, args));
 }
 
+TEST(OclocFatBinaryExtractJobsCount, WhenJobsArgMissingThenReturnsOneAndLeavesArgsIntact) {
+    std::vector<std::string> args = {"ocloc", "-file", "a.cl", "-device", "*", "-j"};
+    auto argsCopy = args;
+    EXPECT_EQ(1U, NEO::extractFatBinaryJobsCount(argsCopy));
+    EXPECT_EQ(args, argsCopy);
+}
+
+TEST(OclocFatBinaryExtractJobsCount, WhenJobsArgProvidedThenReturnsItAndRemovesItFromArgs) {
+    std::vector<std::string> args = {"ocloc", "-j", "8", "-file", "a.cl", "-device", "*"};
+    EXPECT_EQ(8U, NEO::extractFatBinaryJobsCount(args));
+    std::vector<std::string> expectedArgs = {"ocloc", "-file", "a.cl", "-device", "*"};
+    EXPECT_EQ(expectedArgs, args);
+
+    args = {"ocloc", "-file", "a.cl", "-j", "0", "-device", "*"};
+    EXPECT_EQ(1U, NEO::extractFatBinaryJobsCount(args));
+    EXPECT_EQ(expectedArgs, args);
+}
+
 TEST(OclocFatBinaryRequestedFatBinary, WhenDeviceArgProvidedAndContainsFatbinaryArgFormatThenReturnsTrue) {
     const char *allPlatforms[] = {"ocloc", "-device", "*"};
     const char *manyPlatforms[] = {"ocloc", "-device", "a,b"};
@@ -1226,4 +1226,117 @@ TEST(OfflineCompilerTest, givenNoRevisionIdWhenCompilerIsInitializedThenHwInfoHa
     EXPECT_EQ(SUCCESS, retVal);
     EXPECT_EQ(mockOfflineCompiler->hwInfo.platform.usRevId, revId);
 }
+
+TEST(OfflineCompilerTest, givenSameSourceAndOptionsWhenGettingIrSharingKeyThenKeysAreEqual) {
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-q",
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    MockOfflineCompiler firstCompiler;
+    ASSERT_EQ(SUCCESS, firstCompiler.initialize(argv.size(), argv));
+    MockOfflineCompiler secondCompiler;
+    ASSERT_EQ(SUCCESS, secondCompiler.initialize(argv.size(), argv));
+
+    EXPECT_FALSE(firstCompiler.getIrSharingKey().empty());
+    EXPECT_EQ(firstCompiler.getIrSharingKey(), secondCompiler.getIrSharingKey());
+
+    secondCompiler.options += " -cl-opt-disable";
+    EXPECT_NE(firstCompiler.getIrSharingKey(), secondCompiler.getIrSharingKey());
+}
+
+TEST(OfflineCompilerTest, givenDifferentPreferredIntermediateRepresentationsWhenGettingIrSharingKeyThenKeysAreDifferent) {
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-q",
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    MockOfflineCompiler firstCompiler;
+    ASSERT_EQ(SUCCESS, firstCompiler.initialize(argv.size(), argv));
+    MockOfflineCompiler secondCompiler;
+    ASSERT_EQ(SUCCESS, secondCompiler.initialize(argv.size(), argv));
+
+    firstCompiler.preferredIntermediateRepresentation = IGC::CodeType::spirV;
+    secondCompiler.preferredIntermediateRepresentation = IGC::CodeType::llvmBc;
+    EXPECT_NE(firstCompiler.getIrSharingKey(), secondCompiler.getIrSharingKey());
+
+    secondCompiler.preferredIntermediateRepresentation = IGC::CodeType::spirV;
+    EXPECT_EQ(firstCompiler.getIrSharingKey(), secondCompiler.getIrSharingKey());
+}
+
+TEST(OfflineCompilerTest, givenIntermediateRepresentationInputOrLlvmTextOutputWhenGettingIrSharingKeyThenKeyIsEmpty) {
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-q",
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    MockOfflineCompiler mockOfflineCompiler;
+    ASSERT_EQ(SUCCESS, mockOfflineCompiler.initialize(argv.size(), argv));
+
+    mockOfflineCompiler.inputFileSpirV = true;
+    EXPECT_TRUE(mockOfflineCompiler.getIrSharingKey().empty());
+
+    mockOfflineCompiler.inputFileSpirV = false;
+    mockOfflineCompiler.inputFileLlvm = true;
+    EXPECT_TRUE(mockOfflineCompiler.getIrSharingKey().empty());
+
+    mockOfflineCompiler.inputFileLlvm = false;
+    mockOfflineCompiler.useLlvmText = true;
+    EXPECT_TRUE(mockOfflineCompiler.getIrSharingKey().empty());
+}
+
+TEST(OfflineCompilerTest, givenSharedIrWhenBuildSourceCodeIsCalledThenOnlyBackendTranslationIsRequestedAndIrIsKept) {
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-q",
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    MockOfflineCompiler mockOfflineCompiler;
+    ASSERT_EQ(SUCCESS, mockOfflineCompiler.initialize(argv.size(), argv));
+    auto mockIgcOclDeviceCtx = new NEO::MockIgcOclDeviceCtx();
+    mockOfflineCompiler.igcDeviceCtx = CIF::RAII::Pack<IGC::IgcOclDeviceCtxLatest>(mockIgcOclDeviceCtx);
+
+    const uint8_t ir[] = {0x07, 0x23, 0x02, 0x03, 0x00, 0x01};
+    mockOfflineCompiler.useIrBinary(ArrayRef<const uint8_t>(ir), true, "");
+    EXPECT_TRUE(mockOfflineCompiler.isIrBinarySpirV());
+    ASSERT_EQ(sizeof(ir), mockOfflineCompiler.getIrBinary().size());
+    EXPECT_EQ(0, memcmp(ir, mockOfflineCompiler.getIrBinary().begin(), sizeof(ir)));
+
+    auto retVal = mockOfflineCompiler.buildSourceCode();
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    ASSERT_EQ(1U, mockIgcOclDeviceCtx->requestedTranslationCtxs.size());
+    NEO::MockIgcOclDeviceCtx::TranslationOpT expectedTranslation = {IGC::CodeType::spirV, IGC::CodeType::oclGenBin};
+    EXPECT_EQ(expectedTranslation, mockIgcOclDeviceCtx->requestedTranslationCtxs[0]);
+}
+
+TEST(OfflineCompilerTest, givenFrontendBuildLogOfSharedIrWhenIrIsUsedThenBuildLogContainsIt) {
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-q",
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    MockOfflineCompiler mockOfflineCompiler;
+    ASSERT_EQ(SUCCESS, mockOfflineCompiler.initialize(argv.size(), argv));
+    EXPECT_TRUE(mockOfflineCompiler.getBuildLog().empty());
+
+    const uint8_t ir[] = {0x07, 0x23, 0x02, 0x03, 0x00, 0x01};
+    std::string frontendBuildLog = "warning: unused variable";
+    mockOfflineCompiler.useIrBinary(ArrayRef<const uint8_t>(ir), true, frontendBuildLog);
+    EXPECT_STREQ(frontendBuildLog.c_str(), mockOfflineCompiler.getBuildLog().c_str());
+}
 } // namespace NEO
@@ -626,6 +626,94 @@ TEST_F(DrmMemoryManagerTest, Allocate_HostPtr_MisAligned) {
     ::alignedFree(ptrT);
 }
 
+TEST_F(DrmMemoryManagerTest, givenUserptrCacheDisabledByDefaultWhenMemoryManagerIsCreatedThenCacheHasNoCapacity) {
+    auto memoryManager = std::make_unique<TestedDrmMemoryManager>(false, false, false, *executionEnvironment);
+    EXPECT_EQ(0u, memoryManager->userptrCacheMaxSize);
+}
+
+TEST_F(DrmMemoryManagerTest, givenUserptrCacheEnabledWhenHostPtrAllocationIsFreedAndCreatedAgainThenUserptrBoIsReused) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableUserptrCache.set(1);
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    auto memoryManager = std::make_unique<TestedDrmMemoryManager>(false, false, false, *executionEnvironment);
+    EXPECT_EQ(64 * MemoryConstants::megaByte, memoryManager->userptrCacheMaxSize);
+
+    void *ptr = ::alignedMalloc(MemoryConstants::pageSize, MemoryConstants::pageSize);
+    auto allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{rootDeviceIndex, false, MemoryConstants::pageSize}, ptr));
+    ASSERT_NE(nullptr, allocation);
+    auto bo = allocation->getBO();
+    ASSERT_NE(nullptr, bo);
+
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(1u, memoryManager->userptrCache.size());
+    EXPECT_EQ(MemoryConstants::pageSize, memoryManager->userptrCacheSize);
+
+    allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{rootDeviceIndex, false, MemoryConstants::pageSize}, ptr));
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(bo, allocation->getBO());
+    EXPECT_EQ(0u, memoryManager->userptrCache.size());
+    EXPECT_EQ(0u, memoryManager->userptrCacheSize);
+
+    memoryManager->freeGraphicsMemory(allocation);
+    memoryManager.reset();
+    ::alignedFree(ptr);
+}
+
+TEST_F(DrmMemoryManagerTest, givenUserptrCacheFullWhenHostPtrAllocationIsFreedThenLeastRecentlyUsedBoIsClosed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableUserptrCache.set(1);
+    DebugManager.flags.UserptrCacheMaxSizeInMb.set(0);
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    auto memoryManager = std::make_unique<TestedDrmMemoryManager>(false, false, false, *executionEnvironment);
+    EXPECT_EQ(0u, memoryManager->userptrCacheMaxSize);
+
+    void *ptr = ::alignedMalloc(MemoryConstants::pageSize, MemoryConstants::pageSize);
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{rootDeviceIndex, false, MemoryConstants::pageSize}, ptr);
+    ASSERT_NE(nullptr, allocation);
+
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(0u, memoryManager->userptrCache.size());
+    mock->testIoctls();
+
+    ::alignedFree(ptr);
+}
+
+TEST_F(DrmMemoryManagerTest, givenUserptrCacheWhenStoringBosAboveLimitThenLeastRecentlyReleasedBosAreEvicted) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableUserptrCache.set(1);
+    mock->ioctl_expected.gemUserptr = 3;
+    mock->ioctl_expected.gemWait = 2;
+    mock->ioctl_expected.gemClose = 3;
+
+    auto memoryManager = std::make_unique<TestedDrmMemoryManager>(false, false, false, *executionEnvironment);
+    memoryManager->userptrCacheMaxSize = 2 * MemoryConstants::pageSize;
+
+    BufferObject *bos[3];
+    for (auto i = 0u; i < 3; i++) {
+        auto address = (i + 1) * MemoryConstants::pageSize;
+        bos[i] = memoryManager->allocUserptr(address, MemoryConstants::pageSize, 0, rootDeviceIndex);
+        ASSERT_NE(nullptr, bos[i]);
+        EXPECT_TRUE(memoryManager->storeUserptrInCache(bos[i], address, MemoryConstants::pageSize, rootDeviceIndex));
+    }
+    EXPECT_EQ(2u, memoryManager->userptrCache.size());
+    EXPECT_EQ(2 * MemoryConstants::pageSize, memoryManager->userptrCacheSize);
+
+    EXPECT_EQ(nullptr, memoryManager->obtainUserptrFromCache(MemoryConstants::pageSize, MemoryConstants::pageSize, rootDeviceIndex));
+    EXPECT_EQ(nullptr, memoryManager->obtainUserptrFromCache(2 * MemoryConstants::pageSize, MemoryConstants::pageSize, 0u));
+    EXPECT_EQ(nullptr, memoryManager->obtainUserptrFromCache(2 * MemoryConstants::pageSize, 2 * MemoryConstants::pageSize, rootDeviceIndex));
+    EXPECT_EQ(bos[1], memoryManager->obtainUserptrFromCache(2 * MemoryConstants::pageSize, MemoryConstants::pageSize, rootDeviceIndex));
+    EXPECT_EQ(1u, memoryManager->userptrCache.size());
+
+    memoryManager->unreference(bos[1], true);
+    memoryManager.reset();
+}
+
 TEST_F(DrmMemoryManagerTest, Allocate_HostPtr_UserptrFail) {
     mock->ioctl_expected.gemUserptr = 1;
     mock->ioctl_res = -1;
@@ -3299,6 +3387,38 @@ TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenForcePinNotAllowedAndH
     ::alignedFree(const_cast<void *>(allocationData.hostPtr));
 }
 
+TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenUserptrCacheAndHostMemoryValidationEnabledWhenBufferObjectIsReusedFromCacheThenItIsValidatedAgain) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableUserptrCache.set(1);
+
+    std::unique_ptr<TestedDrmMemoryManager> memoryManager(new TestedDrmMemoryManager(false, false, true, *executionEnvironment));
+    memoryManager->registeredEngines = EngineControlContainer{this->device->engines};
+    for (auto engine : memoryManager->registeredEngines) {
+        engine.osContext->incRefInternal();
+    }
+    mock->reset();
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.execbuffer2 = 2;
+
+    AllocationData allocationData;
+    allocationData.size = 4 * 1024;
+    allocationData.hostPtr = ::alignedMalloc(allocationData.size, 4096);
+    allocationData.rootDeviceIndex = device->getRootDeviceIndex();
+    auto alloc = memoryManager->allocateGraphicsMemoryWithHostPtr(allocationData);
+    ASSERT_NE(nullptr, alloc);
+    auto bo = alloc->getBO();
+    memoryManager->freeGraphicsMemory(alloc);
+
+    alloc = memoryManager->allocateGraphicsMemoryWithHostPtr(allocationData);
+    ASSERT_NE(nullptr, alloc);
+    EXPECT_EQ(bo, alloc->getBO());
+    memoryManager->freeGraphicsMemory(alloc);
+    mock->testIoctls();
+
+    memoryManager.reset();
+    ::alignedFree(const_cast<void *>(allocationData.hostPtr));
+}
+
 TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenForcePinNotAllowedAndHostMemoryValidationDisabledWhenAllocationIsCreatedThenBufferObjectIsNotPinned) {
     std::unique_ptr<TestedDrmMemoryManager> memoryManager(new TestedDrmMemoryManager(false, false, false, *executionEnvironment));
     memoryManager->registeredEngines = EngineControlContainer{this->device->engines};
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/constants.h"
+
+#include "opencl/source/mem_obj/buffer.h"
+
+#include "cl_api_tests.h"
+
+#include <memory>
+
+using namespace NEO;
+
+typedef api_tests EnqueueWriteBufferTest;
+
+namespace ULT {
+
+// multiplier of reference ratio that is compared ( checked if less than ) with current result
+const double writeBufferMultiplier = 1.5000;
+// ratio results that are not checked be EXPECT ( very short time tests are not chceked due to high fluctuations )
+const double writeBufferRatioThreshold = 0.005;
+
+//------------------------------------------------------------------------------
+// clEnqueueWriteBuffer from rotating host buffers
+//------------------------------------------------------------------------------
+
+TEST_F(EnqueueWriteBufferTest, clEnqueueWriteBufferFromRotatingHostBuffers) {
+    constexpr size_t hostBuffersCount = 64;
+    constexpr size_t iterationsCount = 1000;
+    // unaligned pointers and sizes, so every transfer registers leading, middle and trailing fragments
+    constexpr size_t transferSize = 4 * MemoryConstants::pageSize + 100;
+
+    double previousRatio = -1.0;
+    uint64_t hash = getHash(__FUNCTION__, strlen(__FUNCTION__));
+
+    bool success = getTestRatio(hash, previousRatio);
+    long long times[3] = {0, 0, 0};
+
+    auto buffer = clCreateBuffer(pContext, CL_MEM_READ_WRITE, transferSize, nullptr, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    auto hostMemory = std::unique_ptr<char, decltype(&alignedFree)>(static_cast<char *>(alignedMalloc(hostBuffersCount * 8 * MemoryConstants::pageSize, MemoryConstants::pageSize)), alignedFree);
+    void *hostBuffers[hostBuffersCount];
+    for (size_t i = 0; i < hostBuffersCount; i++) {
+        hostBuffers[i] = ptrOffset(hostMemory.get(), i * 8 * MemoryConstants::pageSize + 4);
+    }
+
+    for (int i = 0; i < 3; i++) {
+        Timer t;
+        t.start();
+        for (size_t iteration = 0; iteration < iterationsCount; iteration++) {
+            retVal = clEnqueueWriteBuffer(pCmdQ, buffer, CL_FALSE, 0, transferSize, hostBuffers[iteration % hostBuffersCount], 0, nullptr, nullptr);
+        }
+        clFinish(pCmdQ);
+        t.end();
+
+        times[i] = t.get();
+        EXPECT_EQ(CL_SUCCESS, retVal);
+    }
+
+    clReleaseMemObject(buffer);
+
+    long long time = majorityVote(times[0], times[1], times[2]);
+    double ratio = static_cast<double>(time) / static_cast<double>(refTime);
+
+    if (success && previousRatio > writeBufferRatioThreshold) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, writeBufferMultiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+
+    updateTestRatio(hash, ratio);
+}
+} // namespace ULT
@@ -13,13 +13,17 @@
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
 #include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "compiler_options.h"
 #include "igfxfmid.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
+#include <unordered_map>
 
 namespace NEO {
 
@@ -221,6 +225,19 @@ std::vector<ConstStringRef> getTargetPlatformsForFatbinary(ConstStringRef device
     return toProductNames(requestedPlatforms);
 }
 
+uint32_t extractFatBinaryJobsCount(std::vector<std::string> &args) {
+    uint32_t jobsCount = 1U;
+    for (size_t argIndex = 1; argIndex < args.size(); argIndex++) {
+        const bool hasMoreArgs = (argIndex + 1 < args.size());
+        if ((ConstStringRef("-j") == args[argIndex]) && hasMoreArgs) {
+            jobsCount = static_cast<uint32_t>(std::max(atoi(args[argIndex + 1].c_str()), 1));
+            args.erase(args.begin() + argIndex, args.begin() + argIndex + 2);
+            --argIndex;
+        }
+    }
+    return jobsCount;
+}
+
 int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelper) {
     std::string pointerSizeInBits = (sizeof(void *) == 4) ? "32" : "64";
     size_t deviceArgIndex = -1;
@@ -229,9 +246,10 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
     std::string outputDirectory = "";
 
     std::vector<std::string> argsCopy(args);
-    for (size_t argIndex = 1; argIndex < args.size(); argIndex++) {
-        const auto &currArg = args[argIndex];
-        const bool hasMoreArgs = (argIndex + 1 < args.size());
+    auto jobsCount = extractFatBinaryJobsCount(argsCopy);
+    for (size_t argIndex = 1; argIndex < argsCopy.size(); argIndex++) {
+        const auto &currArg = argsCopy[argIndex];
+        const bool hasMoreArgs = (argIndex + 1 < argsCopy.size());
         if ((ConstStringRef("-device") == currArg) && hasMoreArgs) {
             deviceArgIndex = argIndex + 1;
             ++argIndex;
@@ -240,39 +258,100 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         } else if ((CompilerOptions::arch64bit == currArg) || (ConstStringRef("-64") == currArg)) {
             pointerSizeInBits = "64";
         } else if ((ConstStringRef("-file") == currArg) && hasMoreArgs) {
-            inputFileName = args[argIndex + 1];
+            inputFileName = argsCopy[argIndex + 1];
             ++argIndex;
         } else if ((ConstStringRef("-output") == currArg) && hasMoreArgs) {
-            outputFileName = args[argIndex + 1];
+            outputFileName = argsCopy[argIndex + 1];
             ++argIndex;
         } else if ((ConstStringRef("-out_dir") == currArg) && hasMoreArgs) {
-            outputDirectory = args[argIndex + 1];
+            outputDirectory = argsCopy[argIndex + 1];
             ++argIndex;
         }
     }
 
     std::vector<ConstStringRef> targetPlatforms;
-    targetPlatforms = getTargetPlatformsForFatbinary(ConstStringRef(args[deviceArgIndex]), argHelper);
+    targetPlatforms = getTargetPlatformsForFatbinary(ConstStringRef(argsCopy[deviceArgIndex]), argHelper);
     if (targetPlatforms.empty()) {
-        argHelper->printf("Failed to parse target devices from : %s\n", args[deviceArgIndex].c_str());
+        argHelper->printf("Failed to parse target devices from : %s\n", argsCopy[deviceArgIndex].c_str());
         return 1;
     }
 
     NEO::Ar::ArEncoder fatbinary(true);
 
-    for (auto targetPlatform : targetPlatforms) {
-        int retVal = 0;
-        argsCopy[deviceArgIndex] = targetPlatform.str();
+    struct SharedIr {
+        std::vector<uint8_t> binary;
+        bool isSpirV = false;
+        std::string frontendBuildLog;
+    };
+    std::unordered_map<std::string, SharedIr> sharedIrs;
+
+    // targets are processed in batches of jobsCount - compilers are created and results are reported
+    // in target order, only the builds themselves run concurrently
+    for (size_t batchBegin = 0; batchBegin < targetPlatforms.size(); batchBegin += jobsCount) {
+        auto batchSize = std::min(static_cast<size_t>(jobsCount), targetPlatforms.size() - batchBegin);
+        std::vector<std::unique_ptr<OfflineCompiler>> compilers(batchSize);
+        std::vector<std::vector<std::string>> compilersArgs(batchSize);
+        std::vector<int> retVals(batchSize, 0);
+
+        for (size_t i = 0; i < batchSize; ++i) {
+            int retVal = 0;
+            compilersArgs[i] = argsCopy;
+            compilersArgs[i][deviceArgIndex] = targetPlatforms[batchBegin + i].str();
+
+            compilers[i].reset(OfflineCompiler::create(compilersArgs[i].size(), compilersArgs[i], false, retVal, argHelper));
+            if (ErrorCode::SUCCESS != retVal) {
+                argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+                return retVal;
+            }
+        }
+
+        // run the frontend once per unique source/options combination, other targets reuse its IR
+        std::vector<std::string> irKeys(batchSize);
+        std::vector<size_t> irBuilders;
+        for (size_t i = 0; i < batchSize; ++i) {
+            irKeys[i] = compilers[i]->getIrSharingKey();
+            if (irKeys[i].empty() || (sharedIrs.find(irKeys[i]) != sharedIrs.end())) {
+                continue;
+            }
+            bool isFirstWithKey = std::none_of(irBuilders.begin(), irBuilders.end(), [&](size_t builder) { return irKeys[builder] == irKeys[i]; });
+            if (isFirstWithKey) {
+                irBuilders.push_back(i);
+            }
+        }
+
+        parallelFor(irBuilders.size(), jobsCount, [&](size_t builderIdx) {
+            auto i = irBuilders[builderIdx];
+            retVals[i] = buildIrBinaryWithSafetyGuard(compilers[i].get());
+        });
+
+        for (auto i : irBuilders) {
+            if (retVals[i] == 0) {
+                auto ir = compilers[i]->getIrBinary();
+                sharedIrs[irKeys[i]] = SharedIr{std::vector<uint8_t>(ir.begin(), ir.end()), compilers[i]->isIrBinarySpirV(), compilers[i]->getBuildLog()};
+            }
+        }
 
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
-        if (ErrorCode::SUCCESS != retVal) {
-            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
-            return retVal;
+        for (size_t i = 0; i < batchSize; ++i) {
+            auto sharedIr = irKeys[i].empty() ? sharedIrs.end() : sharedIrs.find(irKeys[i]);
+            if (sharedIr != sharedIrs.end()) {
+                // builder of the IR already has frontend build log and warnings in its own log
+                bool isIrBuilder = std::find(irBuilders.begin(), irBuilders.end(), i) != irBuilders.end();
+                compilers[i]->useIrBinary(ArrayRef<const uint8_t>(sharedIr->second.binary), sharedIr->second.isSpirV,
+                                          isIrBuilder ? std::string() : sharedIr->second.frontendBuildLog);
+            }
         }
 
-        auto stepping = pCompiler->getHardwareInfo().platform.usRevId;
-        if (retVal == 0) {
-            retVal = buildWithSafetyGuard(pCompiler.get());
+        parallelFor(batchSize, jobsCount, [&](size_t i) {
+            if (retVals[i] == 0) {
+                retVals[i] = buildWithSafetyGuard(compilers[i].get());
+            }
+        });
+
+        for (size_t i = 0; i < batchSize; ++i) {
+            auto targetPlatform = targetPlatforms[batchBegin + i];
+            auto &pCompiler = compilers[i];
+            auto retVal = retVals[i];
+            auto stepping = pCompiler->getHardwareInfo().platform.usRevId;
 
             std::string buildLog = pCompiler->getBuildLog();
             if (buildLog.empty() == false) {
@@ -285,17 +364,14 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
             } else {
                 argHelper->printf("Build failed for : %s with error code: %d\n", (targetPlatform.str() + "." + std::to_string(stepping)).c_str(), retVal);
                 argHelper->printf("Command was:");
-                for (const auto &arg : argsCopy)
+                for (const auto &arg : compilersArgs[i])
                     argHelper->printf(" %s", arg.c_str());
                 argHelper->printf("\n");
+                return retVal;
             }
-        }
 
-        if (0 != retVal) {
-            return retVal;
+            fatbinary.appendFileEntry(pointerSizeInBits + "." + targetPlatform.str() + "." + std::to_string(stepping), pCompiler->getPackedDeviceBinaryOutput());
         }
-
-        fatbinary.appendFileEntry(pointerSizeInBits + "." + targetPlatform.str() + "." + std::to_string(stepping), pCompiler->getPackedDeviceBinaryOutput());
     }
 
     auto fatbinaryData = fatbinary.encode();
@@ -24,6 +24,8 @@ inline bool requestedFatBinary(int argc, const char *argv[]) {
     return requestedFatBinary(args);
 }
 
+uint32_t extractFatBinaryJobsCount(std::vector<std::string> &args);
+
 int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelper);
 inline int buildFatBinary(int argc, const char *argv[], OclocArgHelper *argHelper) {
     std::vector<std::string> args;
@@ -152,6 +152,33 @@ int OfflineCompiler::buildIrBinary() {
     return retVal;
 }
 
+std::string OfflineCompiler::getIrSharingKey() const {
+    // frontend output depends only on the source, build options, OpenCL version and
+    // IR type preferred by FCL, so compilers with equal keys can reuse a single IR and run only the backend
+    if (inputFileLlvm || inputFileSpirV || useLlvmText || onlySpirV) {
+        return "";
+    }
+    std::string key = std::to_string(hwInfo.capabilityTable.clVersionSupport);
+    key.push_back('\0');
+    key.append(std::to_string(useLlvmBc ? IGC::CodeType::llvmBc : preferredIntermediateRepresentation));
+    key.push_back('\0');
+    key.append(options);
+    key.push_back('\0');
+    key.append(internalOptions);
+    key.push_back('\0');
+    key.append(sourceCode);
+    return key;
+}
+
+void OfflineCompiler::useIrBinary(ArrayRef<const uint8_t> ir, bool irIsSpirV, const std::string &frontendBuildLog) {
+    updateBuildLog(frontendBuildLog.c_str(), frontendBuildLog.size());
+    storeBinary(irBinary, irBinarySize, ir.begin(), ir.size());
+    isSpirV = irIsSpirV;
+    sourceCode.assign(reinterpret_cast<const char *>(ir.begin()), ir.size());
+    inputFileSpirV = irIsSpirV;
+    inputFileLlvm = !irIsSpirV;
+}
+
 int OfflineCompiler::buildSourceCode() {
     int retVal = SUCCESS;
 
@@ -796,6 +823,10 @@ Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename
 
   -revision_id <revision_id>    Target stepping.
 
+Fatbinary options (used only when -device selects multiple targets):
+  -j <N>                        Optional number of target devices compiled
+                                concurrently. Default is 1.
+
 Examples :
   Compile file to Intel Compute GPU device binary (out = source_file_Gen9core.bin)
     ocloc -file source_file.cl -device skl
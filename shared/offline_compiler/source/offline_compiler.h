@@ -74,6 +74,18 @@ class OfflineCompiler {
         return hwInfo;
     }
 
+    std::string getIrSharingKey() const;
+    int buildIrBinary();
+    void useIrBinary(ArrayRef<const uint8_t> ir, bool irIsSpirV, const std::string &frontendBuildLog);
+
+    ArrayRef<const uint8_t> getIrBinary() const {
+        return ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(irBinary), irBinarySize);
+    }
+
+    bool isIrBinarySpirV() const {
+        return isSpirV;
+    }
+
   protected:
     OfflineCompiler();
 
@@ -87,7 +99,6 @@ class OfflineCompiler {
     void parseDebugSettings();
     void storeBinary(char *&pDst, size_t &dstSize, const void *pSrc, const size_t srcSize);
     MOCKABLE_VIRTUAL int buildSourceCode();
-    int buildIrBinary();
     void updateBuildLog(const char *pErrorString, const size_t errorStringSize);
     MOCKABLE_VIRTUAL bool generateElfBinary();
     std::string generateFilePathForIr(const std::string &fileNameBase) {
@@ -17,3 +17,10 @@ int buildWithSafetyGuard(OfflineCompiler *compiler) {
 
     return safetyGuard.call<int, OfflineCompiler, decltype(&OfflineCompiler::build)>(compiler, &OfflineCompiler::build, retVal);
 }
+
+int buildIrBinaryWithSafetyGuard(OfflineCompiler *compiler) {
+    SafetyGuardLinux safetyGuard;
+    int retVal = 0;
+
+    return safetyGuard.call<int, OfflineCompiler, decltype(&OfflineCompiler::buildIrBinary)>(compiler, &OfflineCompiler::buildIrBinary, retVal);
+}
@@ -10,4 +10,5 @@ namespace NEO {
 class OfflineCompiler;
 }
 
-extern int buildWithSafetyGuard(NEO::OfflineCompiler *compiler);
\ No newline at end of file
+extern int buildWithSafetyGuard(NEO::OfflineCompiler *compiler);
+extern int buildIrBinaryWithSafetyGuard(NEO::OfflineCompiler *compiler);
\ No newline at end of file
@@ -15,3 +15,9 @@ int buildWithSafetyGuard(OfflineCompiler *compiler) {
     int retVal = 0;
     return safetyGuard.call<int, OfflineCompiler, decltype(&OfflineCompiler::build)>(compiler, &OfflineCompiler::build, retVal);
 }
+
+int buildIrBinaryWithSafetyGuard(OfflineCompiler *compiler) {
+    SafetyGuardWindows safetyGuard;
+    int retVal = 0;
+    return safetyGuard.call<int, OfflineCompiler, decltype(&OfflineCompiler::buildIrBinary)>(compiler, &OfflineCompiler::buildIrBinary, retVal);
+}
@@ -57,7 +57,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
     {
         auto alloc = dispatchInterface->getIsaAllocation();
         UNRECOVERABLE_IF(nullptr == alloc);
-        auto offset = alloc->getGpuAddressToPatch();
+        auto offset = alloc->getGpuAddressToPatch() + dispatchInterface->getIsaOffsetInAllocation();
         idd.setKernelStartPointer(offset);
         idd.setKernelStartPointerHigh(0u);
     }
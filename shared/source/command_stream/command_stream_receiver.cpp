@@ -251,6 +251,44 @@ FlushStamp CommandStreamReceiver::obtainCurrentFlushStamp() const {
     return flushStamp->peekStamp();
 }
 
+void CommandStreamReceiver::enableAdaptiveBatchedDispatch() {
+    auto lock = obtainUniqueOwnership();
+    if (this->adaptiveBatchedDispatchUsers++ == 0) {
+        this->dispatchModeWithoutAdaptiveBatching = this->dispatchMode;
+        this->dispatchMode = DispatchMode::BatchedDispatch;
+        this->adaptiveBatchedDispatchEnabled = true;
+    }
+    if (DebugManager.flags.AdaptiveBatchedDispatchMaxTasks.get() != -1) {
+        this->maxBatchedTasks = static_cast<uint32_t>(DebugManager.flags.AdaptiveBatchedDispatchMaxTasks.get());
+    }
+}
+
+void CommandStreamReceiver::disableAdaptiveBatchedDispatch() {
+    auto lock = obtainUniqueOwnership();
+    DEBUG_BREAK_IF(this->adaptiveBatchedDispatchUsers == 0);
+    if (this->adaptiveBatchedDispatchUsers == 0 || --this->adaptiveBatchedDispatchUsers != 0) {
+        return;
+    }
+    this->flushBatchedSubmissions();
+    this->adaptiveBatchedDispatchEnabled = false;
+    this->dispatchMode = this->dispatchModeWithoutAdaptiveBatching;
+}
+
+void CommandStreamReceiver::registerBatchedTask() {
+    batchedTasksCount++;
+}
+
+bool CommandStreamReceiver::isAdaptiveBatchSubmissionRequired(const DispatchFlags &dispatchFlags) const {
+    if (!adaptiveBatchedDispatchEnabled) {
+        return false;
+    }
+    if (!dispatchFlags.adaptiveBatchedDispatch) {
+        // tasks of queues not using adaptive batching keep dispatch mode the CSR would have without it
+        return dispatchModeWithoutAdaptiveBatching == DispatchMode::ImmediateDispatch;
+    }
+    return batchedTasksCount >= maxBatchedTasks;
+}
+
 void CommandStreamReceiver::setRequiredScratchSizes(uint32_t newRequiredScratchSize, uint32_t newRequiredPrivateScratchSize) {
     if (newRequiredScratchSize > requiredScratchSize) {
         requiredScratchSize = newRequiredScratchSize;
@@ -120,7 +120,15 @@ class CommandStreamReceiver {
 
     void enableNTo1SubmissionModel() { this->nTo1SubmissionModelEnabled = true; }
     bool isNTo1SubmissionModelEnabled() const { return this->nTo1SubmissionModelEnabled; }
-    void overrideDispatchPolicy(DispatchMode overrideValue) { this->dispatchMode = overrideValue; }
+    void overrideDispatchPolicy(DispatchMode overrideValue) {
+        this->dispatchModeWithoutAdaptiveBatching = overrideValue;
+        if (!this->adaptiveBatchedDispatchEnabled) {
+            this->dispatchMode = overrideValue;
+        }
+    }
+    void enableAdaptiveBatchedDispatch();
+    void disableAdaptiveBatchedDispatch();
+    bool isAdaptiveBatchedDispatchEnabled() const { return this->adaptiveBatchedDispatchEnabled; }
 
     void setMediaVFEStateDirty(bool dirty) { mediaVfeStateDirty = dirty; }
 
@@ -185,6 +193,11 @@ class CommandStreamReceiver {
         this->latestSentTaskCount = latestSentTaskCount;
     }
 
+    uint32_t peekLastSentThreadArbitrationPolicy() const { return lastSentThreadArbitrationPolicy; }
+    void setLastSentThreadArbitrationPolicy(uint32_t threadArbitrationPolicy) {
+        this->lastSentThreadArbitrationPolicy = threadArbitrationPolicy;
+    }
+
     virtual uint32_t blitBuffer(const BlitPropertiesContainer &blitPropertiesContainer, bool blocking, bool profilingEnabled) = 0;
 
     ScratchSpaceController *getScratchSpaceController() const {
@@ -215,6 +228,9 @@ class CommandStreamReceiver {
     bool isRcs() const;
 
   protected:
+    void registerBatchedTask();
+    bool isAdaptiveBatchSubmissionRequired(const DispatchFlags &dispatchFlags) const;
+
     void cleanupResources();
     void printDeviceIndex();
 
@@ -261,6 +277,7 @@ class CommandStreamReceiver {
 
     OsContext *osContext = nullptr;
     DispatchMode dispatchMode = DispatchMode::ImmediateDispatch;
+    DispatchMode dispatchModeWithoutAdaptiveBatching = DispatchMode::ImmediateDispatch;
     SamplerCacheFlushState samplerCacheFlushRequired = SamplerCacheFlushState::samplerCacheFlushNotRequired;
     PreemptionMode lastPreemptionMode = PreemptionMode::Initial;
     uint64_t totalMemoryUsed = 0u;
@@ -275,6 +292,9 @@ class CommandStreamReceiver {
     uint32_t lastSentThreadArbitrationPolicy = ThreadArbitrationPolicy::NotPresent;
     uint64_t lastSentSliceCount = QueueSliceCount::defaultSliceCount;
 
+    uint32_t batchedTasksCount = 0;
+    uint32_t maxBatchedTasks = 16;
+    uint32_t adaptiveBatchedDispatchUsers = 0;
     uint32_t requiredScratchSize = 0;
     uint32_t requiredPrivateScratchSize = 0;
 
@@ -293,6 +313,7 @@ class CommandStreamReceiver {
     bool stallingPipeControlOnNextFlushRequired = false;
     bool timestampPacketWriteEnabled = false;
     bool nTo1SubmissionModelEnabled = false;
+    bool adaptiveBatchedDispatchEnabled = false;
     bool lastSpecialPipelineSelectMode = false;
     bool requiresInstructionCacheFlush = false;
 
@@ -15,6 +15,7 @@
 #include "shared/source/direct_submission/direct_submission_hw.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/gmm_helper/page_table_mngr.h"
+#include "shared/source/helpers/bindless_heaps_helper.h"
 #include "shared/source/helpers/blit_commands_helper.h"
 #include "shared/source/helpers/cache_policy.h"
 #include "shared/source/helpers/flat_batch_buffer_helper_hw.h"
@@ -181,6 +182,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     auto levelClosed = false;
     void *currentPipeControlForNooping = nullptr;
     void *epiloguePipeControlLocation = nullptr;
+    bool pipeControlForNoopingFlushesDc = false;
 
     if (DebugManager.flags.ForceCsrFlushing.get()) {
         flushBatchedSubmissions();
@@ -210,6 +212,10 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
         if ((dispatchFlags.outOfOrderExecutionAllowed || timestampPacketWriteEnabled) &&
             !dispatchFlags.dcFlush) {
             currentPipeControlForNooping = epiloguePipeControlLocation;
+        } else if (dispatchFlags.outOfOrderExecutionAllowed && !timestampPacketWriteEnabled) {
+            //completion is observed only through tag, dc flush may be deferred to the epilogue of aggregated submission
+            currentPipeControlForNooping = epiloguePipeControlLocation;
+            pipeControlForNoopingFlushesDc = true;
         }
 
         auto address = getTagAllocation()->getGpuAddress();
@@ -349,6 +355,11 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
 
     bool sourceLevelDebuggerActive = device.getSourceLevelDebugger() != nullptr ? true : false;
 
+    auto bindlessHeapsHelper = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->bindlessHeapsHelper.get();
+    if (bindlessHeapsHelper) {
+        makeResident(*bindlessHeapsHelper->getHeapAllocation());
+    }
+
     //Reprogram state base address if required
     if (isStateBaseAddressDirty || sourceLevelDebuggerActive) {
         addPipeControlBeforeStateBaseAddress(commandStreamCSR);
@@ -379,6 +390,9 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
             true,
             device.getGmmHelper(),
             isMultiOsContextCapable());
+        if (bindlessHeapsHelper) {
+            StateBaseAddressHelper<GfxFamily>::programBindlessSurfaceStateBaseAddress(&cmd, bindlessHeapsHelper->getGlobalHeapGpuBase(), bindlessHeapsHelper->getHeapSize());
+        }
         *pCmd = cmd;
 
         if (sshDirty) {
@@ -537,8 +551,12 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
             commandBuffer->taskCount = this->taskCount + 1;
             commandBuffer->flushStamp->replaceStampObject(dispatchFlags.flushStampReference);
             commandBuffer->pipeControlThatMayBeErasedLocation = currentPipeControlForNooping;
+            commandBuffer->pipeControlThatMayBeErasedFlushesDc = pipeControlForNoopingFlushesDc;
             commandBuffer->epiloguePipeControlLocation = epiloguePipeControlLocation;
             this->submissionAggregator->recordCommandBuffer(commandBuffer);
+            if (dispatchFlags.adaptiveBatchedDispatch) {
+                this->registerBatchedTask();
+            }
         }
     } else {
         this->makeSurfacePackNonResident(this->getResidencyAllocations());
@@ -551,7 +569,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
         }
     }
 
-    if (this->dispatchMode == DispatchMode::BatchedDispatch && (dispatchFlags.blocking || dispatchFlags.implicitFlush)) {
+    if (this->dispatchMode == DispatchMode::BatchedDispatch && (dispatchFlags.blocking || dispatchFlags.implicitFlush || isAdaptiveBatchSubmissionRequired(dispatchFlags))) {
         this->flushBatchedSubmissions();
     }
 
@@ -613,6 +631,8 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
 
     auto &commandBufferList = this->submissionAggregator->peekCmdBufferList();
     if (!commandBufferList.peekIsEmpty()) {
+        this->submissionAggregator->resetAggregationStatistics();
+        auto &aggregationStatistics = this->submissionAggregator->getAggregationStatistics();
         const auto totalMemoryBudget = static_cast<size_t>(commandBufferList.peekHead()->device.getDeviceInfo().globalMemSize / 2);
 
         ResidencyContainer surfacesForSubmit;
@@ -620,8 +640,10 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
         auto pipeControlLocationSize = MemorySynchronizationCommands<GfxFamily>::getSizeForPipeControlWithPostSyncOperation(peekHwInfo());
         void *currentPipeControlForNooping = nullptr;
         void *epiloguePipeControlLocation = nullptr;
+        bool pipeControlForNoopingFlushesDc = false;
 
         while (!commandBufferList.peekIsEmpty()) {
+            bool dcFlushDeferredToEpilogue = false;
             size_t totalUsedSize = 0u;
             this->submissionAggregator->aggregateCommandBuffers(resourcePackage, totalUsedSize, totalMemoryBudget, osContext->getContextId());
             auto primaryCmdBuffer = commandBufferList.removeFrontOne();
@@ -633,6 +655,7 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
             flushStampUpdateHelper.insert(primaryCmdBuffer->flushStamp->getStampReference());
 
             currentPipeControlForNooping = primaryCmdBuffer->pipeControlThatMayBeErasedLocation;
+            pipeControlForNoopingFlushesDc = primaryCmdBuffer->pipeControlThatMayBeErasedFlushesDc;
             epiloguePipeControlLocation = primaryCmdBuffer->epiloguePipeControlLocation;
 
             if (DebugManager.flags.FlattenBatchBufferForAUBDump.get()) {
@@ -645,9 +668,12 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
                         flatBatchBufferHelper->removePipeControlData(pipeControlLocationSize, currentPipeControlForNooping, peekHwInfo());
                     }
                     memset(currentPipeControlForNooping, 0, pipeControlLocationSize);
+                    dcFlushDeferredToEpilogue |= pipeControlForNoopingFlushesDc;
+                    aggregationStatistics.erasedPipeControlsCount++;
                 }
                 //obtain next candidate for nooping
                 currentPipeControlForNooping = nextCommandBuffer->pipeControlThatMayBeErasedLocation;
+                pipeControlForNoopingFlushesDc = nextCommandBuffer->pipeControlThatMayBeErasedFlushesDc;
                 //track epilogue pipe control
                 epiloguePipeControlLocation = nextCommandBuffer->epiloguePipeControlLocation;
 
@@ -672,7 +698,7 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
             //make sure we flush DC if needed
             if (epiloguePipeControlLocation) {
                 bool flushDcInEpilogue = true;
-                if (DebugManager.flags.DisableDcFlushInEpilogue.get()) {
+                if (DebugManager.flags.DisableDcFlushInEpilogue.get() && !dcFlushDeferredToEpilogue) {
                     flushDcInEpilogue = false;
                 }
                 ((PIPE_CONTROL *)epiloguePipeControlLocation)->setDcFlushEnable(flushDcInEpilogue);
@@ -693,6 +719,11 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
             resourcePackage.clear();
         }
         this->totalMemoryUsed = 0;
+        this->batchedTasksCount = 0;
+
+        printDebugString(DebugManager.flags.PrintSubmissionAggregationStatistics.get(), stdout,
+                         "Submission aggregation: %u command buffers in %u submissions, %u pipe controls erased\n",
+                         aggregationStatistics.commandBuffersCount, aggregationStatistics.submissionsCount, aggregationStatistics.erasedPipeControlsCount);
     }
 
     return submitResult;
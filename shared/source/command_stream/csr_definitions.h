@@ -94,6 +94,7 @@ struct DispatchFlags {
     bool outOfOrderExecutionAllowed = false;
     bool epilogueRequired = false;
     bool usePerDssBackedBuffer = false;
+    bool adaptiveBatchedDispatch = false;
 };
 
 struct CsrSizeRequestFlags {
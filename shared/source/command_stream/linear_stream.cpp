@@ -11,8 +11,10 @@
 
 namespace NEO {
 
+std::atomic<uint64_t> LinearStream::bufferGenerationCounter{0};
+
 LinearStream::LinearStream(GraphicsAllocation *gfxAllocation, void *buffer, size_t bufferSize)
-    : sizeUsed(0), maxAvailableSpace(bufferSize), buffer(buffer), graphicsAllocation(gfxAllocation) {
+    : sizeUsed(0), maxAvailableSpace(bufferSize), buffer(buffer), graphicsAllocation(gfxAllocation), bufferGeneration(++bufferGenerationCounter) {
 }
 
 LinearStream::LinearStream(void *buffer, size_t bufferSize)
@@ -20,7 +22,7 @@ LinearStream::LinearStream(void *buffer, size_t bufferSize)
 }
 
 LinearStream::LinearStream(GraphicsAllocation *gfxAllocation)
-    : sizeUsed(0), graphicsAllocation(gfxAllocation) {
+    : sizeUsed(0), graphicsAllocation(gfxAllocation), bufferGeneration(++bufferGenerationCounter) {
     if (gfxAllocation) {
         maxAvailableSpace = gfxAllocation->getUnderlyingBufferSize();
         buffer = gfxAllocation->getUnderlyingBuffer();
@@ -32,6 +32,7 @@ class LinearStream {
     void replaceBuffer(void *buffer, size_t bufferSize);
     GraphicsAllocation *getGraphicsAllocation() const;
     void replaceGraphicsAllocation(GraphicsAllocation *gfxAllocation);
+    uint64_t getBufferGeneration() const;
 
     template <typename Cmd>
     Cmd *getSpaceForCmd() {
@@ -44,6 +45,10 @@ class LinearStream {
     size_t maxAvailableSpace;
     void *buffer;
     GraphicsAllocation *graphicsAllocation;
+
+    // Unique across all streams, changes whenever the stream starts over in a new or recycled buffer
+    uint64_t bufferGeneration;
+    static std::atomic<uint64_t> bufferGenerationCounter;
 };
 
 inline void *LinearStream::getCpuBase() const {
@@ -78,6 +83,7 @@ inline void LinearStream::replaceBuffer(void *buffer, size_t bufferSize) {
     this->buffer = buffer;
     maxAvailableSpace = bufferSize;
     sizeUsed = 0;
+    bufferGeneration = ++bufferGenerationCounter;
 }
 
 inline GraphicsAllocation *LinearStream::getGraphicsAllocation() const {
@@ -87,4 +93,8 @@ inline GraphicsAllocation *LinearStream::getGraphicsAllocation() const {
 inline void LinearStream::replaceGraphicsAllocation(GraphicsAllocation *gfxAllocation) {
     graphicsAllocation = gfxAllocation;
 }
+
+inline uint64_t LinearStream::getBufferGeneration() const {
+    return bufferGeneration;
+}
 } // namespace NEO
@@ -7,6 +7,8 @@
 
 #include "shared/source/command_stream/scratch_space_controller.h"
 
+#include "shared/source/command_stream/scratch_space_pool.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/hw_helper.h"
@@ -23,6 +25,8 @@ ScratchSpaceController::ScratchSpaceController(uint32_t rootDeviceIndex, Executi
 }
 
 ScratchSpaceController::~ScratchSpaceController() {
+    printDebugString(DebugManager.flags.PrintScratchSpaceStatistics.get(), stdout, "Scratch space controller: %u reallocations, last scratch size %zu\n",
+                     scratchReallocationsCount, scratchSizeBytes);
     if (scratchAllocation) {
         getMemoryManager()->freeGraphicsMemory(scratchAllocation);
     }
@@ -35,4 +39,8 @@ MemoryManager *ScratchSpaceController::getMemoryManager() const {
     UNRECOVERABLE_IF(executionEnvironment.memoryManager.get() == nullptr);
     return executionEnvironment.memoryManager.get();
 }
+
+ScratchSpacePool *ScratchSpaceController::getScratchSpacePool() const {
+    return executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->scratchSpacePool.get();
+}
 } // namespace NEO
@@ -20,6 +20,7 @@ class InternalAllocationStorage;
 class MemoryManager;
 struct HardwareInfo;
 class OsContext;
+class ScratchSpacePool;
 
 namespace ScratchSpaceConstants {
 constexpr size_t scratchSpaceOffsetFor64Bit = 4096u;
@@ -48,8 +49,13 @@ class ScratchSpaceController {
 
     virtual void reserveHeap(IndirectHeap::Type heapType, IndirectHeap *&indirectHeap) = 0;
 
+    uint32_t getScratchReallocationsCount() const {
+        return scratchReallocationsCount;
+    }
+
   protected:
     MemoryManager *getMemoryManager() const;
+    ScratchSpacePool *getScratchSpacePool() const;
 
     const uint32_t rootDeviceIndex;
     ExecutionEnvironment &executionEnvironment;
@@ -60,5 +66,6 @@ class ScratchSpaceController {
     size_t privateScratchSizeBytes = 0;
     bool force32BitAllocation = false;
     uint32_t computeUnitsUsedForScratch = 0;
+    uint32_t scratchReallocationsCount = 0;
 };
 } // namespace NEO
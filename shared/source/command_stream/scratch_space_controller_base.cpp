@@ -7,6 +7,7 @@
 
 #include "shared/source/command_stream/scratch_space_controller_base.h"
 
+#include "shared/source/command_stream/scratch_space_pool.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/constants.h"
@@ -31,11 +32,17 @@ void ScratchSpaceControllerBase::setRequiredScratchSpace(void *sshBaseAddress,
                                                          bool &vfeStateDirty) {
     size_t requiredScratchSizeInBytes = requiredPerThreadScratchSize * computeUnitsUsedForScratch;
     if (requiredScratchSizeInBytes && (!scratchAllocation || scratchSizeBytes < requiredScratchSizeInBytes)) {
+        auto scratchSpacePool = getScratchSpacePool();
         if (scratchAllocation) {
             scratchAllocation->updateTaskCount(currentTaskCount, osContext.getContextId());
-            csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(scratchAllocation), TEMPORARY_ALLOCATION);
+            if (scratchSpacePool) {
+                scratchSpacePool->releaseAllocation(scratchAllocation, csrAllocationStorage.getDeviceBitfield());
+            } else {
+                csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(scratchAllocation), TEMPORARY_ALLOCATION);
+            }
+            scratchReallocationsCount++;
         }
-        scratchSizeBytes = requiredScratchSizeInBytes;
+        scratchSizeBytes = scratchSpacePool ? ScratchSpacePool::getSizeClass(requiredScratchSizeInBytes) : requiredScratchSizeInBytes;
         createScratchSpaceAllocation();
         vfeStateDirty = true;
         force32BitAllocation = getMemoryManager()->peekForce32BitAllocations();
@@ -46,6 +53,14 @@ void ScratchSpaceControllerBase::setRequiredScratchSpace(void *sshBaseAddress,
 }
 
 void ScratchSpaceControllerBase::createScratchSpaceAllocation() {
+    auto scratchSpacePool = getScratchSpacePool();
+    if (scratchSpacePool) {
+        scratchAllocation = scratchSpacePool->obtainAllocation(scratchSizeBytes, this->csrAllocationStorage.getDeviceBitfield());
+        if (scratchAllocation) {
+            scratchSizeBytes = scratchAllocation->getUnderlyingBufferSize();
+            return;
+        }
+    }
     scratchAllocation = getMemoryManager()->allocateGraphicsMemoryWithProperties({rootDeviceIndex, scratchSizeBytes, GraphicsAllocation::AllocationType::SCRATCH_SURFACE, this->csrAllocationStorage.getDeviceBitfield()});
     UNRECOVERABLE_IF(scratchAllocation == nullptr);
 }
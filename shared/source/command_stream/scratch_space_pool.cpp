@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/scratch_space_pool.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+ScratchSpacePool::~ScratchSpacePool() {
+    for (auto &pooledAllocation : pooledAllocations) {
+        memoryManager.freeGraphicsMemory(pooledAllocation.second.allocation);
+    }
+}
+
+size_t ScratchSpacePool::getSizeClass(size_t requiredSize) {
+    return std::max(static_cast<size_t>(Math::nextPowerOfTwo(static_cast<uint64_t>(requiredSize))), minimalSizeClass);
+}
+
+size_t ScratchSpacePool::getPooledAllocationsCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return pooledAllocations.size();
+}
+
+bool ScratchSpacePool::isAllocationIdle(GraphicsAllocation &allocation) const {
+    for (auto &engine : memoryManager.getRegisteredEngines()) {
+        auto contextId = engine.osContext->getContextId();
+        if (allocation.isUsedByOsContext(contextId) &&
+            allocation.getTaskCount(contextId) > *engine.commandStreamReceiver->getTagAddress()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+GraphicsAllocation *ScratchSpacePool::obtainAllocation(size_t requiredSize, DeviceBitfield deviceBitfield) {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto it = pooledAllocations.lower_bound(requiredSize); it != pooledAllocations.end(); it++) {
+        if (it->second.deviceBitfield == deviceBitfield && isAllocationIdle(*it->second.allocation)) {
+            auto allocation = it->second.allocation;
+            pooledAllocations.erase(it);
+            reusedAllocationsCount++;
+            return allocation;
+        }
+    }
+    return nullptr;
+}
+
+void ScratchSpacePool::releaseAllocation(GraphicsAllocation *allocation, DeviceBitfield deviceBitfield) {
+    std::lock_guard<std::mutex> lock(mtx);
+    pooledAllocations.insert({allocation->getUnderlyingBufferSize(), {allocation, deviceBitfield}});
+    trim();
+}
+
+void ScratchSpacePool::trim() {
+    // smallest idle allocations are released first, busy ones stay pooled until a later release
+    for (auto it = pooledAllocations.begin(); it != pooledAllocations.end() && pooledAllocations.size() > maxPooledAllocations;) {
+        if (isAllocationIdle(*it->second.allocation)) {
+            memoryManager.freeGraphicsMemory(it->second.allocation);
+            it = pooledAllocations.erase(it);
+        } else {
+            it++;
+        }
+    }
+}
+
+} // namespace NEO
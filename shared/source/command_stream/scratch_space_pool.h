@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/common_types.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+namespace NEO {
+class GraphicsAllocation;
+class MemoryManager;
+
+// Scratch allocations released by scratch space controllers of a root device, keyed by power-of-two size class.
+// An allocation is handed out again, also to a controller of a different engine, only after every engine using it
+// completed its work, so engines never share a scratch allocation concurrently.
+class ScratchSpacePool : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t minimalSizeClass = 64 * 1024u;
+    static constexpr size_t maxPooledAllocations = 8u;
+
+    ScratchSpacePool(MemoryManager &memoryManager) : memoryManager(memoryManager) {}
+    ~ScratchSpacePool();
+
+    GraphicsAllocation *obtainAllocation(size_t requiredSize, DeviceBitfield deviceBitfield);
+    void releaseAllocation(GraphicsAllocation *allocation, DeviceBitfield deviceBitfield);
+
+    size_t getPooledAllocationsCount() const;
+    uint32_t getReusedAllocationsCount() const { return reusedAllocationsCount; }
+
+    static size_t getSizeClass(size_t requiredSize);
+
+  protected:
+    struct PooledAllocation {
+        GraphicsAllocation *allocation;
+        DeviceBitfield deviceBitfield;
+    };
+    using PooledAllocations = std::multimap<size_t, PooledAllocation>;
+
+    bool isAllocationIdle(GraphicsAllocation &allocation) const;
+    void trim();
+
+    MemoryManager &memoryManager;
+    PooledAllocations pooledAllocations;
+    uint32_t reusedAllocationsCount = 0u;
+    mutable std::mutex mtx;
+};
+} // namespace NEO
@@ -25,6 +25,8 @@ void NEO::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resourc
 
     this->inspectionId++;
     primaryCommandBuffer->inspectionId = currentInspection;
+    aggregationStatistics.submissionsCount++;
+    aggregationStatistics.commandBuffersCount++;
 
     //primary command buffers must fix to budget
     for (auto &graphicsAllocation : primaryCommandBuffer->surfaces) {
@@ -40,27 +42,15 @@ void NEO::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resourc
         return;
     }
 
-    //check if next cmd buffer is compatible
-    if (primaryCommandBuffer->next->batchBuffer.requiresCoherency != primaryCommandBuffer->batchBuffer.requiresCoherency) {
-        return;
-    }
-
-    if (primaryCommandBuffer->next->batchBuffer.low_priority != primaryCommandBuffer->batchBuffer.low_priority) {
-        return;
-    }
-
-    if (primaryCommandBuffer->next->batchBuffer.throttle != primaryCommandBuffer->batchBuffer.throttle) {
-        return;
-    }
-
-    if (primaryCommandBuffer->next->batchBuffer.sliceCount != primaryCommandBuffer->batchBuffer.sliceCount) {
-        return;
-    }
-
     auto nextCommandBuffer = primaryCommandBuffer->next;
     ResourcePackage newResources;
 
     while (nextCommandBuffer) {
+        //every merged cmd buffer is submitted with properties of primary one
+        if (!areBatchBuffersCompatible(primaryCommandBuffer->batchBuffer, nextCommandBuffer->batchBuffer)) {
+            break;
+        }
+
         size_t nextCommandBufferNewResourcesSize = 0;
         //evaluate if buffer fits
         for (auto &graphicsAllocation : nextCommandBuffer->surfaces) {
@@ -87,6 +77,7 @@ void NEO::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resourc
             nextCommandBuffer = nextCommandBuffer->next;
             totalUsedSize += nextCommandBufferNewResourcesSize;
             currentNode->inspectionId = currentInspection;
+            aggregationStatistics.commandBuffersCount++;
 
             for (auto &newResource : newResources) {
                 resourcePackage.push_back(newResource);
@@ -98,6 +89,13 @@ void NEO::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resourc
     }
 }
 
+bool NEO::SubmissionAggregator::areBatchBuffersCompatible(const BatchBuffer &primaryBatchBuffer, const BatchBuffer &nextBatchBuffer) {
+    return nextBatchBuffer.requiresCoherency == primaryBatchBuffer.requiresCoherency &&
+           nextBatchBuffer.low_priority == primaryBatchBuffer.low_priority &&
+           nextBatchBuffer.throttle == primaryBatchBuffer.throttle &&
+           nextBatchBuffer.sliceCount == primaryBatchBuffer.sliceCount;
+}
+
 NEO::BatchBuffer::BatchBuffer(GraphicsAllocation *commandBufferAllocation, size_t startOffset,
                               size_t chainedBatchBufferStartOffset, GraphicsAllocation *chainedBatchBuffer,
                               bool requiresCoherency, bool lowPriority,
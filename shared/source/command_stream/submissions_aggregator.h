@@ -55,6 +55,7 @@ struct CommandBuffer : public IDNode<CommandBuffer> {
     uint32_t inspectionId = 0;
     uint32_t taskCount = 0u;
     void *pipeControlThatMayBeErasedLocation = nullptr;
+    bool pipeControlThatMayBeErasedFlushesDc = false;
     void *epiloguePipeControlLocation = nullptr;
     std::unique_ptr<FlushStampTracker> flushStamp;
     Device &device;
@@ -64,14 +65,25 @@ struct CommandBufferList : public IDList<CommandBuffer, false, true, false> {};
 
 using ResourcePackage = StackVec<GraphicsAllocation *, 128>;
 
+struct AggregationStatistics {
+    uint32_t commandBuffersCount = 0u;
+    uint32_t submissionsCount = 0u;
+    uint32_t erasedPipeControlsCount = 0u;
+};
+
 class SubmissionAggregator {
   public:
     void recordCommandBuffer(CommandBuffer *commandBuffer);
     void aggregateCommandBuffers(ResourcePackage &resourcePackage, size_t &totalUsedSize, size_t totalMemoryBudget, uint32_t osContextId);
     CommandBufferList &peekCmdBufferList() { return cmdBuffers; }
+    AggregationStatistics &getAggregationStatistics() { return aggregationStatistics; }
+    void resetAggregationStatistics() { aggregationStatistics = {}; }
 
   protected:
+    static bool areBatchBuffersCompatible(const BatchBuffer &primaryBatchBuffer, const BatchBuffer &nextBatchBuffer);
+
     CommandBufferList cmdBuffers;
+    AggregationStatistics aggregationStatistics;
     uint32_t inspectionId = 1;
 };
 } // namespace NEO
@@ -26,6 +26,12 @@ namespace NEO {
 std::mutex CompilerCache::cacheAccessMtx;
 const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
                                                    const ArrayRef<const char> options, const ArrayRef<const char> internalOptions) {
+    return getCachedFileName(hwInfo, input, options, internalOptions, ArrayRef<const char>());
+}
+
+const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
+                                                   const ArrayRef<const char> options, const ArrayRef<const char> internalOptions,
+                                                   const ArrayRef<const char> additionalInput) {
     Hash hash;
 
     hash.update("----", 4);
@@ -41,6 +47,11 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
     hash.update(reinterpret_cast<const char *>(&hwInfo.featureTable), sizeof(hwInfo.featureTable));
     hash.update("----", 4);
     hash.update(reinterpret_cast<const char *>(&hwInfo.workaroundTable), sizeof(hwInfo.workaroundTable));
+    // keep names of plain source builds unchanged so that existing cache entries stay valid
+    if (false == additionalInput.empty()) {
+        hash.update("----", 4);
+        hash.update(&*additionalInput.begin(), additionalInput.size());
+    }
 
     auto res = hash.finish();
     std::stringstream stream;
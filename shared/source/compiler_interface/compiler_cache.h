@@ -28,6 +28,9 @@ class CompilerCache {
   public:
     static const std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
                                                ArrayRef<const char> options, ArrayRef<const char> internalOptions);
+    static const std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
+                                               ArrayRef<const char> options, ArrayRef<const char> internalOptions,
+                                               ArrayRef<const char> additionalInput);
 
     CompilerCache(const CompilerCacheConfig &config);
     virtual ~CompilerCache() = default;
@@ -13,6 +13,7 @@
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/utilities/const_stringref.h"
 
 #include "opencl/source/os_interface/os_inc_base.h"
 
@@ -26,7 +27,9 @@
 #undef IGC_CLEANUP
 #include "ocl_igc_interface/platform_helper.h"
 
+#include <algorithm>
 #include <fstream>
+#include <vector>
 
 namespace NEO {
 SpinLock CompilerInterface::spinlock;
@@ -37,6 +40,24 @@ enum CachingMode {
     PreProcess
 };
 
+// spec constants and the translation stage are not part of the source, so they have to be hashed separately
+static std::string getCacheAdditionalInput(const std::string &stage, const specConstValuesMap &specializedValues) {
+    std::vector<std::pair<uint32_t, uint64_t>> sortedSpecConsts(specializedValues.begin(), specializedValues.end());
+    std::sort(sortedSpecConsts.begin(), sortedSpecConsts.end());
+
+    std::string additionalInput = stage;
+    for (const auto &specConst : sortedSpecConsts) {
+        additionalInput.append(reinterpret_cast<const char *>(&specConst.first), sizeof(specConst.first));
+        additionalInput.append(reinterpret_cast<const char *>(&specConst.second), sizeof(specConst.second));
+    }
+    return additionalInput;
+}
+
+static bool containsInclude(ArrayRef<const char> src) {
+    const ConstStringRef includeDirective = "#include";
+    return std::search(src.begin(), src.end(), includeDirective.begin(), includeDirective.end()) != src.end();
+}
+
 CompilerInterface::CompilerInterface()
     : cache() {
 }
@@ -68,11 +89,13 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     }
 
     std::string kernelFileHash;
+    const auto cacheAdditionalInput = getCacheAdditionalInput("", input.specializedValues);
     if (cachingMode == CachingMode::Direct) {
         kernelFileHash = CompilerCache::getCachedFileName(device.getHardwareInfo(),
                                                           input.src,
                                                           input.apiOptions,
-                                                          input.internalOptions);
+                                                          input.internalOptions,
+                                                          ArrayRef<const char>(cacheAdditionalInput));
         output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
         if (output.deviceBinary.mem) {
             return TranslationOutput::ErrorCode::Success;
@@ -125,7 +148,8 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     if (cachingMode == CachingMode::PreProcess) {
         kernelFileHash = CompilerCache::getCachedFileName(device.getHardwareInfo(), ArrayRef<const char>(intermediateRepresentation->GetMemory<char>(), intermediateRepresentation->GetSize<char>()),
                                                           input.apiOptions,
-                                                          input.internalOptions);
+                                                          input.internalOptions,
+                                                          ArrayRef<const char>(cacheAdditionalInput));
         output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
         if (output.deviceBinary.mem) {
             return TranslationOutput::ErrorCode::Success;
@@ -176,6 +200,23 @@ TranslationOutput::ErrorCode CompilerInterface::compile(
         outType = getPreferredIntermediateRepresentation(device);
     }
 
+    // headers included from outside of the input can change without changing the input itself
+    bool allowCaching = input.allowCaching && (false == containsInclude(input.src));
+    std::string kernelFileHash;
+    if (allowCaching) {
+        const auto cacheAdditionalInput = getCacheAdditionalInput("compile:" + std::to_string(outType), input.specializedValues);
+        kernelFileHash = CompilerCache::getCachedFileName(device.getHardwareInfo(),
+                                                          input.src,
+                                                          input.apiOptions,
+                                                          input.internalOptions,
+                                                          ArrayRef<const char>(cacheAdditionalInput));
+        output.intermediateRepresentation.mem = cache->loadCachedBinary(kernelFileHash, output.intermediateRepresentation.size);
+        if (output.intermediateRepresentation.mem) {
+            output.intermediateCodeType = outType;
+            return TranslationOutput::ErrorCode::Success;
+        }
+    }
+
     auto fclSrc = CIF::Builtins::CreateConstBuffer(fclMain.get(), input.src.begin(), input.src.size());
     auto fclOptions = CIF::Builtins::CreateConstBuffer(fclMain.get(), input.apiOptions.begin(), input.apiOptions.size());
     auto fclInternalOptions = CIF::Builtins::CreateConstBuffer(fclMain.get(), input.internalOptions.begin(), input.internalOptions.size());
@@ -195,6 +236,10 @@ TranslationOutput::ErrorCode CompilerInterface::compile(
         return TranslationOutput::ErrorCode::CompilationFailure;
     }
 
+    if (allowCaching) {
+        cache->cacheBinary(kernelFileHash, fclOutput->GetOutput()->GetMemory<char>(), static_cast<uint32_t>(fclOutput->GetOutput()->GetSize<char>()));
+    }
+
     output.intermediateCodeType = outType;
     TranslationOutput::makeCopy(output.intermediateRepresentation, fclOutput->GetOutput());
 
@@ -209,6 +254,20 @@ TranslationOutput::ErrorCode CompilerInterface::link(
         return TranslationOutput::ErrorCode::CompilerNotAvailable;
     }
 
+    std::string kernelFileHash;
+    if (input.allowCaching) {
+        const auto cacheAdditionalInput = getCacheAdditionalInput("link", input.specializedValues);
+        kernelFileHash = CompilerCache::getCachedFileName(device.getHardwareInfo(),
+                                                          input.src,
+                                                          input.apiOptions,
+                                                          input.internalOptions,
+                                                          ArrayRef<const char>(cacheAdditionalInput));
+        output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
+        if (output.deviceBinary.mem) {
+            return TranslationOutput::ErrorCode::Success;
+        }
+    }
+
     auto inSrc = CIF::Builtins::CreateConstBuffer(igcMain.get(), input.src.begin(), input.src.size());
     auto igcOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), input.apiOptions.begin(), input.apiOptions.size());
     auto igcInternalOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), input.internalOptions.begin(), input.internalOptions.size());
@@ -243,6 +302,10 @@ TranslationOutput::ErrorCode CompilerInterface::link(
         currSrc.reset(currOut->GetOutput());
     }
 
+    if (input.allowCaching) {
+        cache->cacheBinary(kernelFileHash, currOut->GetOutput()->GetMemory<char>(), static_cast<uint32_t>(currOut->GetOutput()->GetSize<char>()));
+    }
+
     TranslationOutput::makeCopy(output.backendCompilerLog, currOut->GetBuildLog());
     TranslationOutput::makeCopy(output.deviceBinary, currOut->GetOutput());
     TranslationOutput::makeCopy(output.debugData, currOut->GetDebugData());
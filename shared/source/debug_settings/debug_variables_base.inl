@@ -105,6 +105,9 @@ DECLARE_DEBUG_VARIABLE(bool, PrintTimestampPacketContents, false, "prints all ti
 DECLARE_DEBUG_VARIABLE(bool, WddmResidencyLogger, false, "gather Wddm residency statistics to file")
 DECLARE_DEBUG_VARIABLE(bool, PrintBOCreateDestroyResult, false, "tracks the result of creation and destruction of BOs")
 DECLARE_DEBUG_VARIABLE(bool, PrintBOBindingResult, false, "tracks the result of binding and unbinding of BOs")
+DECLARE_DEBUG_VARIABLE(bool, PrintStateCommandsStatistics, false, "prints number of emitted and elided state commands for each command queue submission")
+DECLARE_DEBUG_VARIABLE(bool, PrintSubmissionAggregationStatistics, false, "prints number of command buffers, submissions and erased pipe controls for each flush of batched submissions")
+DECLARE_DEBUG_VARIABLE(bool, PrintScratchSpaceStatistics, false, "prints number of scratch space reallocations when command stream receiver is destroyed")
 
 /*DIRECT SUBMISSION FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmission, -1, "-1: default (disabled), 0: disable, 1:enable. Enables direct submission of command buffers bypassing KMD")
@@ -139,6 +142,21 @@ DECLARE_DEBUG_VARIABLE(bool, DisableStatelessToStatefulOptimization, false, "Dis
 DECLARE_DEBUG_VARIABLE(bool, DisableConcurrentBlockExecution, false, "disables concurrent block kernel execution")
 DECLARE_DEBUG_VARIABLE(bool, UseNoRingFlushesKmdMode, true, "Windows only, passes flag to KMD that informs KMD to not emit any ring buffer flushes.")
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForUseHostPtr, false, "When active all buffer allocations created with CL_MEM_USE_HOST_PTR flag will not share memory with CPU.")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableUserptrCache, -1, "-1: default (disabled), 0: disabled, 1: enabled. Linux only, keeps userptr BOs of released host ptr fragments for reuse by transfers from the same pages")
+DECLARE_DEBUG_VARIABLE(int32_t, UserptrCacheMaxSizeInMb, -1, "-1: default (64MB), >=0: maximal size of host memory kept registered in userptr cache")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableParallelCpuCopy, -1, "-1: default (disabled), 0: disabled, 1: enabled. Splits large CPU transfers of buffers between worker threads")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelCpuCopyThreads, -1, "-1: default (half of hardware threads, up to 16), >0: number of threads participating in parallel CPU copy")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelCpuCopyMinSizeInKb, -1, "-1: default (1MB), >=0: minimal size of CPU copy split between worker threads")
+DECLARE_DEBUG_VARIABLE(int32_t, NonTemporalCpuCopyMinSizeInKb, -1, "-1: default (8MB), >=0: minimal size of CPU copy using non-temporal stores")
+DECLARE_DEBUG_VARIABLE(int32_t, EnablePackedKernelIsa, -1, "-1: default (disabled), 0: disabled, 1: enabled. Places ISA of all kernels from a module in shared allocations")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLazyKernelInitialization, -1, "-1: default (disabled), 0: disabled, 1: enabled. Uploads ISA and builds heap templates of a module kernel when it is first used")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableParallelKernelDecoding, -1, "-1: default (disabled), 0: disabled, 1: enabled. Decodes kernels and uploads their ISA on multiple threads when creating programs and modules")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelKernelDecodingThreads, -1, "-1: default (half of hardware threads, up to 8), >0: maximal number of threads decoding kernels")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableReusableAllocationsPool, -1, "-1: default (disabled), 0: disabled, 1: enabled. Keeps reusable allocations of command stream receiver in buckets of type and power-of-two size")
+DECLARE_DEBUG_VARIABLE(int32_t, ReusableAllocationsPoolBudgetInMb, -1, "-1: default (unlimited), >=0: completed allocations above this size of reusable allocations pool are released")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableScratchSpacePool, -1, "-1: default (disabled), 0: disabled, 1: enabled. Scratch allocations are rounded to power-of-two size classes and released ones are reused by all engines of a root device")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableIndirectDataReuse, -1, "-1: default (disabled), 0: disabled, 1: enabled. Re-enqueue of a kernel with unchanged cross thread data points walker to indirect data already present in indirect heap instead of copying it again")
+DECLARE_DEBUG_VARIABLE(int32_t, LocalIdsCacheMaxEntries, -1, "-1: default (256), >=0: maximal number of per thread data blocks kept in local ids cache of a device")
 
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableNV12, true, "Enables NV12 extension")
@@ -161,6 +179,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, OverrideEnableQuickKmdSleepForSporadicWaits, -1,
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideDelayQuickKmdSleepForSporadicWaitsMicroseconds, -1, "-1: dont override, >0: timeout in microseconds")
 DECLARE_DEBUG_VARIABLE(int32_t, PowerSavingMode, 0, "0: default 1: enable. Whenever driver waits on GPU and its not ready, put waiting thread to sleep and wait for notification.")
 DECLARE_DEBUG_VARIABLE(int32_t, CsrDispatchMode, 0, "Chooses DispatchMode for Csr")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAdaptiveBatchedDispatch, -1, "-1: default (disabled), 0: disabled, 1: enabled. In-order queues batch consecutive tasks without host visible events, ignored when CsrDispatchMode is set")
+DECLARE_DEBUG_VARIABLE(int32_t, AdaptiveBatchedDispatchMaxTasks, -1, "-1: default (16), >0: number of batched tasks that triggers submission in adaptive batched dispatch")
 DECLARE_DEBUG_VARIABLE(int32_t, RenderCompressedImagesEnabled, -1, "-1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, RenderCompressedBuffersEnabled, -1, "-1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableSharedSystemUsmSupport, -1, "-1: default, 0: shared system memory disabled, 1: shared system memory enabled")
@@ -185,6 +205,7 @@ DECLARE_DEBUG_VARIABLE(bool, EnableFreeMemory, false, "Enable freeMemory in memo
 DECLARE_DEBUG_VARIABLE(bool, ForceSamplerLowFilteringPrecision, false, "Force Low Filtering Precision Sampler mode")
 DECLARE_DEBUG_VARIABLE(bool, UseBindlessBuffers, false, "Force compiler to use bindless buffer addressing instead of stateful one")
 DECLARE_DEBUG_VARIABLE(bool, UseBindlessImages, false, "Force compiler to use bindless image addressing instead of stateful one")
+DECLARE_DEBUG_VARIABLE(bool, UseGlobalBindlessHeap, false, "Keep surface states of bindless kernel arguments in a global heap instead of copying them into every dispatch, requires UseBindlessBuffers or UseBindlessImages")
 
 /*DRIVER TOGGLES*/
 DECLARE_DEBUG_VARIABLE(bool, ForcePerDssBackedBufferProgramming, false, "Always program per-DSS memory backed buffer in preamble")
@@ -10,8 +10,10 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/experimental_command_buffer.h"
 #include "shared/source/command_stream/preemption.h"
+#include "shared/source/command_stream/scratch_space_pool.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
+#include "shared/source/helpers/bindless_heaps_helper.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/driver_info.h"
@@ -56,6 +58,17 @@ bool Device::createDeviceImpl() {
     hwHelper.setupHardwareCapabilities(&this->hardwareCapabilities, hwInfo);
     executionEnvironment->rootDeviceEnvironments[getRootDeviceIndex()]->initGmm();
 
+    auto &rootDeviceEnvironment = *executionEnvironment->rootDeviceEnvironments[getRootDeviceIndex()];
+    if (DebugManager.flags.UseGlobalBindlessHeap.get() && !rootDeviceEnvironment.bindlessHeapsHelper) {
+        rootDeviceEnvironment.bindlessHeapsHelper = std::make_unique<BindlessHeapsHelper>(executionEnvironment->memoryManager.get(),
+                                                                                          getRootDeviceIndex(),
+                                                                                          getDeviceBitfield(),
+                                                                                          hwHelper.getRenderSurfaceStateSize());
+    }
+    if (DebugManager.flags.EnableScratchSpacePool.get() == 1 && !rootDeviceEnvironment.scratchSpacePool) {
+        rootDeviceEnvironment.scratchSpacePool = std::make_unique<ScratchSpacePool>(*executionEnvironment->memoryManager);
+    }
+
     if (!createEngines()) {
         return false;
     }
@@ -12,6 +12,8 @@
 #include "shared/source/utilities/arrayref.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <string>
+
 namespace NEO {
 namespace Ar {
 
@@ -79,6 +81,63 @@ inline ConstStringRef readLongFileName(ConstStringRef longFileNamesSection, size
     return ConstStringRef(longFileNamesSection.begin() + offset, end - offset);
 }
 
+// Walks file entries of the archive one by one, without materializing them, and calls
+// fileEntryVisitor(const ArFileEntryHeaderAndData &) for each regular file entry.
+// Walking stops early when fileEntryVisitor returns false.
+template <typename FileEntryVisitorT>
+bool decodeArFileEntries(const ArrayRef<const uint8_t> binary, ArFileEntryHeaderAndData &outLongFileNamesEntry, std::string &outErrReason, std::string &outWarnings, FileEntryVisitorT &&fileEntryVisitor) {
+    if (false == isAr(binary)) {
+        outErrReason = "Not an AR archive - mismatched file signature";
+        return false;
+    }
+
+    const uint8_t *decodePos = binary.begin() + arMagic.size();
+    while (decodePos + sizeof(ArFileEntryHeader) <= binary.end()) {
+        auto fileEntryHeader = reinterpret_cast<const ArFileEntryHeader *>(decodePos);
+        auto fileEntryDataPos = decodePos + sizeof(ArFileEntryHeader);
+        uint64_t fileSize = readDecimal<sizeof(fileEntryHeader->fileSizeInBytes)>(fileEntryHeader->fileSizeInBytes);
+        if (fileSize + (fileEntryDataPos - binary.begin()) > binary.size()) {
+            outErrReason = "Corrupt AR archive - out of bounds data of file entry with idenfitier '" + std::string(fileEntryHeader->identifier, sizeof(fileEntryHeader->identifier)) + "'";
+            return false;
+        }
+
+        if (ConstStringRef::fromArray(fileEntryHeader->trailingMagic) != arFileEntryTrailingMagic) {
+            outWarnings.append("File entry header with identifier '" + std::string(fileEntryHeader->identifier, sizeof(fileEntryHeader->identifier)) + "' has invalid header trailing string");
+        }
+
+        ArFileEntryHeaderAndData fileEntry = {};
+        fileEntry.fileName = readUnpaddedString<sizeof(fileEntryHeader->identifier)>(fileEntryHeader->identifier);
+        fileEntry.fullHeader = fileEntryHeader;
+        fileEntry.fileData = ArrayRef<const uint8_t>(fileEntryDataPos, static_cast<size_t>(fileSize));
+
+        if (fileEntry.fileName.empty()) {
+            if (SpecialFileNames::longFileNamesFile == ConstStringRef(fileEntryHeader->identifier, 2U)) {
+                fileEntry.fileName = SpecialFileNames::longFileNamesFile;
+                outLongFileNamesEntry = fileEntry;
+            } else {
+                outErrReason = "Corrupt AR archive - file entry does not have identifier : '" + std::string(fileEntryHeader->identifier, sizeof(fileEntryHeader->identifier)) + "'";
+                return false;
+            }
+        } else {
+            if (SpecialFileNames::longFileNamePrefix == fileEntry.fileName[0]) {
+                auto longFileNamePos = readDecimal<sizeof(fileEntryHeader->identifier) - 1>(fileEntryHeader->identifier + 1);
+                fileEntry.fileName = readLongFileName(ConstStringRef(reinterpret_cast<const char *>(outLongFileNamesEntry.fileData.begin()), outLongFileNamesEntry.fileData.size()), static_cast<size_t>(longFileNamePos));
+                if (fileEntry.fileName.empty()) {
+                    outErrReason = "Corrupt AR archive - long file name entry has broken identifier : '" + std::string(fileEntryHeader->identifier, sizeof(fileEntryHeader->identifier)) + "'";
+                    return false;
+                }
+            }
+            if (false == fileEntryVisitor(fileEntry)) {
+                return true;
+            }
+        }
+
+        decodePos = fileEntryDataPos + fileSize;
+        decodePos += fileSize & 1U; // implicit 2-byte alignment
+    }
+    return true;
+}
+
 Ar decodeAr(const ArrayRef<const uint8_t> binary, std::string &outErrReason, std::string &outWarnings);
 
 } // namespace Ar
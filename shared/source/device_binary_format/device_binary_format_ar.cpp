@@ -19,43 +19,59 @@ bool isDeviceBinaryFormat<NEO::DeviceBinaryFormat::Archive>(const ArrayRef<const
 template <>
 SingleDeviceBinary unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::Archive>(const ArrayRef<const uint8_t> archive, const ConstStringRef requestedProductAbbreviation, const TargetDevice &requestedTargetDevice,
                                                                               std::string &outErrReason, std::string &outWarning) {
-    auto archiveData = NEO::Ar::decodeAr(archive, outErrReason, outWarning);
-    if (nullptr == archiveData.magic) {
-        return {};
-    }
-
     std::string pointerSize = ((requestedTargetDevice.maxPointerSizeInBytes == 8) ? "64" : "32");
     std::string filterPointerSizeAndPlatform = pointerSize + "." + requestedProductAbbreviation.str();
     std::string filterPointerSizeAndPlatformAndStepping = filterPointerSizeAndPlatform + "." + std::to_string(requestedTargetDevice.stepping);
+    auto hasPrefix = [](ConstStringRef fileName, ConstStringRef prefix) {
+        return (fileName.size() >= prefix.size()) && (ConstStringRef(fileName.begin(), prefix.size()) == prefix);
+    };
 
-    Ar::ArFileEntryHeaderAndData *matchedFiles[2] = {};
-    Ar::ArFileEntryHeaderAndData *&matchedPointerSizeAndPlatformAndStepping = matchedFiles[0]; // best match
-    Ar::ArFileEntryHeaderAndData *&matchedPointerSizeAndPlatform = matchedFiles[1];
-    for (auto &f : archiveData.files) {
-        if (ConstStringRef(f.fileName.begin(), filterPointerSizeAndPlatform.size()) != filterPointerSizeAndPlatform) {
-            continue;
+    // archive is walked only until the perfect match is found - remaining file entries are neither decoded nor validated
+    Ar::ArFileEntryHeaderAndData longFileNamesEntry;
+    Ar::ArFileEntryHeaderAndData matchedFiles[2] = {};
+    Ar::ArFileEntryHeaderAndData &matchedPointerSizeAndPlatformAndStepping = matchedFiles[0]; // best match
+    Ar::ArFileEntryHeaderAndData &matchedPointerSizeAndPlatform = matchedFiles[1];
+    bool searchForPerfectMatch = true;
+    auto findMatchingFiles = [&](const Ar::ArFileEntryHeaderAndData &f) {
+        if (false == hasPrefix(f.fileName, filterPointerSizeAndPlatform)) {
+            return true;
         }
 
-        if (ConstStringRef(f.fileName.begin(), filterPointerSizeAndPlatformAndStepping.size()) != filterPointerSizeAndPlatformAndStepping) {
-            matchedPointerSizeAndPlatform = &f;
-            continue;
+        if (false == hasPrefix(f.fileName, filterPointerSizeAndPlatformAndStepping)) {
+            matchedPointerSizeAndPlatform = f;
+            return true;
         }
-        matchedPointerSizeAndPlatformAndStepping = &f;
+        if (searchForPerfectMatch) {
+            matchedPointerSizeAndPlatformAndStepping = f;
+        }
+        return false == searchForPerfectMatch;
+    };
+    if (false == Ar::decodeArFileEntries(archive, longFileNamesEntry, outErrReason, outWarning, findMatchingFiles)) {
+        return {};
     }
 
     std::string unpackErrors;
     std::string unpackWarnings;
-    for (auto matchedFile : matchedFiles) {
-        if (nullptr == matchedFile) {
+    for (auto &matchedFile : matchedFiles) {
+        if (nullptr == matchedFile.fullHeader) {
             continue;
         }
-        auto unpacked = unpackSingleDeviceBinary(matchedFile->fileData, requestedProductAbbreviation, requestedTargetDevice, unpackErrors, unpackWarnings);
+        auto unpacked = unpackSingleDeviceBinary(matchedFile.fileData, requestedProductAbbreviation, requestedTargetDevice, unpackErrors, unpackWarnings);
         if (false == unpacked.deviceBinary.empty()) {
-            if (matchedFile != matchedPointerSizeAndPlatformAndStepping) {
+            if (&matchedFile != &matchedPointerSizeAndPlatformAndStepping) {
                 outWarning = "Couldn't find perfectly matched binary (right stepping) in AR, using best usable";
             }
             return unpacked;
         }
+
+        if (&matchedFile == &matchedPointerSizeAndPlatformAndStepping) {
+            // perfect match is unusable - look for the best usable match in the whole archive
+            searchForPerfectMatch = false;
+            matchedPointerSizeAndPlatform = {};
+            std::string rescanErrors;
+            std::string rescanWarnings;
+            Ar::decodeArFileEntries(archive, longFileNamesEntry, rescanErrors, rescanWarnings, findMatchingFiles);
+        }
     }
 
     outErrReason = "Couldn't find matching binary in AR archive";
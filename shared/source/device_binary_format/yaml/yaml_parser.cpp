@@ -7,6 +7,8 @@
 
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 namespace Yaml {
@@ -21,28 +23,35 @@ std::string constructYamlError(size_t lineNumber, const char *lineBeg, const cha
     return ret;
 }
 
+// note : resizing outNodes may reallocate its storage, so nodes are re-fetched by id afterwards
 inline Node &addNode(NodesCache &outNodes, Node &parent) {
-    parent.firstChildId = static_cast<NodeId>(outNodes.size());
-    parent.lastChildId = static_cast<NodeId>(outNodes.size());
+    auto parentId = parent.id;
+    auto currId = static_cast<NodeId>(outNodes.size());
+    parent.firstChildId = currId;
+    parent.lastChildId = currId;
+    ++parent.numChildren;
     outNodes.resize(outNodes.size() + 1);
     auto &curr = *outNodes.rbegin();
-    curr.id = parent.lastChildId;
-    curr.parentId = parent.id;
-    ++parent.numChildren;
+    curr.id = currId;
+    curr.parentId = parentId;
     return curr;
 }
 
 inline Node &addNode(NodesCache &outNodes, Node &prevSibling, Node &parent) {
-    prevSibling.nextSiblingId = static_cast<NodeId>(outNodes.size());
+    auto parentId = parent.id;
+    auto currId = static_cast<NodeId>(outNodes.size());
+    prevSibling.nextSiblingId = currId;
+    parent.lastChildId = currId;
+    ++parent.numChildren;
     outNodes.resize(outNodes.size() + 1);
     auto &curr = *outNodes.rbegin();
-    curr.id = prevSibling.nextSiblingId;
-    curr.parentId = parent.id;
-    parent.lastChildId = curr.id;
-    ++parent.numChildren;
+    curr.id = currId;
+    curr.parentId = parentId;
     return curr;
 }
 
+struct TreeBuilder;
+
 struct TokenizerContext {
     TokenizerContext(ConstStringRef text)
         : pos(text.begin()),
@@ -59,9 +68,102 @@ struct TokenizerContext {
     const char *lineBeginPos = nullptr;
     bool isParsingIdent = false;
     Line::LineTraits lineTraits;
+
+    size_t lineId = 0U;
+    LinesCache *outLines = nullptr;
+    TreeBuilder *treeBuilder = nullptr;
+    bool treeBuildFailed = false;
 };
 
-bool tokenizeEndLine(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens, std::string &outErrReason, std::string &outWarning, TokenizerContext &context) {
+void finalizeNode(NodeId nodeId, const TokensCache &tokens, NodesCache &outNodes, std::string &outErrReason, std::string &outWarning);
+
+struct TreeBuilder {
+    TreeBuilder(const TokensCache &tokens, NodesCache &outNodes)
+        : tokens(tokens), outNodes(outNodes) {
+        outNodes.resize(1);
+        outNodes.rbegin()->id = 0U;
+        outNodes.rbegin()->firstChildId = 1U;
+        outNodes.rbegin()->lastChildId = 1U;
+        nesting.resize(1); // root
+    }
+
+    bool addLine(const Line &line, size_t lineId, std::string &outErrReason, std::string &outWarning) {
+        if (isUnused(line.lineType)) {
+            return true;
+        }
+
+        auto currLineIndent = line.indent;
+        if (currLineIndent == outNodes.rbegin()->indent) {
+            auto &prev = *outNodes.rbegin();
+            auto &parent = outNodes[*nesting.rbegin()];
+            auto &curr = addNode(outNodes, prev, parent);
+            curr.indent = currLineIndent;
+        } else if (currLineIndent > outNodes.rbegin()->indent) {
+            auto &parent = *outNodes.rbegin();
+            nesting.push_back(parent.id);
+            auto &curr = addNode(outNodes, parent);
+            curr.indent = currLineIndent;
+        } else {
+            while (currLineIndent < outNodes[*nesting.rbegin()].indent) {
+                finalizeNode(*nesting.rbegin(), tokens, outNodes, outErrReason, outWarning);
+                UNRECOVERABLE_IF(nesting.empty());
+                nesting.pop_back();
+            }
+            bool hasInvalidIndent = (currLineIndent != outNodes[*nesting.rbegin()].indent);
+            if (hasInvalidIndent) {
+                outErrReason = constructYamlError(lineId, tokens[line.first].pos, tokens[line.first].pos + 1, "Invalid indentation");
+                return false;
+            } else {
+                auto &prev = outNodes[*nesting.rbegin()];
+                auto &parent = outNodes[prev.parentId];
+                auto &curr = addNode(outNodes, prev, parent);
+                curr.indent = currLineIndent;
+            }
+        }
+
+        if (line.traits.hasInlineDataMarkers) {
+            outErrReason = "Inline collections are not supported yet\n";
+            return false;
+        }
+
+        if (Line::LineType::DictionaryEntry == line.lineType) {
+            auto numTokensInLine = line.last - line.first + 1;
+            outNodes.rbegin()->key = line.first;
+            UNRECOVERABLE_IF(numTokensInLine < 3); // at least key, : and \n
+            if (('#' != tokens[line.first + 2]) && ('\n' != tokens[line.first + 2])) {
+                outNodes.rbegin()->value = line.first + 2;
+            }
+        } else {
+            auto numTokensInLine = line.last - line.first + 1;
+            (void)numTokensInLine;
+            UNRECOVERABLE_IF(numTokensInLine < 2); // at least : - and \n
+            UNRECOVERABLE_IF(Line::LineType::ListEntry != line.lineType);
+            UNRECOVERABLE_IF('-' != tokens[line.first]);
+            if (('#' != tokens[line.first + 1]) && ('\n' != tokens[line.first + 1])) {
+                outNodes.rbegin()->value = line.first + 1;
+            }
+        }
+        return true;
+    }
+
+    void finish(std::string &outErrReason, std::string &outWarning) {
+        while (false == nesting.empty()) {
+            finalizeNode(*nesting.rbegin(), tokens, outNodes, outErrReason, outWarning);
+            nesting.pop_back();
+        }
+
+        if (1U == outNodes.size()) {
+            outWarning.append("NEO::Yaml : Text has no data\n");
+            outNodes.clear();
+        }
+    }
+
+    const TokensCache &tokens;
+    NodesCache &outNodes;
+    StackVec<NodeId, 64> nesting;
+};
+
+bool tokenizeEndLine(ConstStringRef text, TokensCache &outTokens, std::string &outErrReason, std::string &outWarning, TokenizerContext &context) {
     TokenId lineEnd = static_cast<uint32_t>(outTokens.size());
     outTokens.push_back(Token(ConstStringRef(context.pos, 1), Token::SingleCharacter));
     auto lineBegToken = outTokens[context.lineBegin];
@@ -69,12 +171,12 @@ bool tokenizeEndLine(ConstStringRef text, LinesCache &outLines, TokensCache &out
     if (lineEnd != context.lineBegin) {
         switch (lineBegToken.traits.type) {
         default:
-            outErrReason = constructYamlError(outLines.size(), lineBegToken.pos, context.pos, "Internal error - undefined line type");
+            outErrReason = constructYamlError(context.lineId, lineBegToken.pos, context.pos, "Internal error - undefined line type");
             return false;
         case Token::SingleCharacter:
             switch (lineBegToken.traits.character0) {
             default:
-                outErrReason = constructYamlError(outLines.size(), lineBegToken.pos, context.pos, (std::string("Unhandled keyword character : ") + lineBegToken.traits.character0).c_str());
+                outErrReason = constructYamlError(context.lineId, lineBegToken.pos, context.pos, (std::string("Unhandled keyword character : ") + lineBegToken.traits.character0).c_str());
                 return false;
             case '#':
                 lineType = Line::LineType::Comment;
@@ -95,7 +197,17 @@ bool tokenizeEndLine(ConstStringRef text, LinesCache &outLines, TokensCache &out
             break;
         }
     }
-    outLines.push_back(Line{lineType, static_cast<uint16_t>(context.lineIndent), context.lineBegin, lineEnd, context.lineTraits});
+    Line line{lineType, static_cast<uint16_t>(context.lineIndent), context.lineBegin, lineEnd, context.lineTraits};
+    if (nullptr != context.outLines) {
+        context.outLines->push_back(line);
+    }
+    if (nullptr != context.treeBuilder) {
+        if (false == context.treeBuilder->addLine(line, context.lineId, outErrReason, outWarning)) {
+            context.treeBuildFailed = true;
+            return false;
+        }
+    }
+    ++context.lineId;
     ++context.pos;
 
     context.lineIndent = 0U;
@@ -106,15 +218,13 @@ bool tokenizeEndLine(ConstStringRef text, LinesCache &outLines, TokensCache &out
     return true;
 }
 
-bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens, std::string &outErrReason, std::string &outWarning) {
+bool tokenize(ConstStringRef text, TokensCache &outTokens, std::string &outErrReason, std::string &outWarning, TokenizerContext &context) {
     if (text.empty()) {
         outWarning.append("NEO::Yaml : input text is empty\n");
         return true;
     }
 
-    TokenizerContext context{text};
     context.isParsingIdent = true;
-
     while (context.pos < context.end) {
         switch (context.pos[0]) {
         case ' ':
@@ -124,7 +234,7 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
         case '\t':
             if (context.isParsingIdent) {
                 context.lineIndent += 4U;
-                outWarning.append("NEO::Yaml : Tabs used as indent at line : " + std::to_string(outLines.size()) + "\n");
+                outWarning.append("NEO::Yaml : Tabs used as indent at line : " + std::to_string(context.lineId) + "\n");
             }
             ++context.pos;
             break;
@@ -149,7 +259,7 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
             break;
         }
         case '\n': {
-            if (false == tokenizeEndLine(text, outLines, outTokens, outErrReason, outWarning, context)) {
+            if (false == tokenizeEndLine(text, outTokens, outErrReason, outWarning, context)) {
                 return false;
             }
         } break;
@@ -158,7 +268,7 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
             context.isParsingIdent = false;
             auto parseTokEnd = consumeStringLiteral(text, context.pos);
             if (parseTokEnd == context.pos) {
-                outErrReason = constructYamlError(outLines.size(), context.lineBeginPos, context.pos, "Underminated string");
+                outErrReason = constructYamlError(context.lineId, context.lineBeginPos, context.pos, "Underminated string");
                 return false;
             }
             outTokens.push_back(Token(ConstStringRef(context.pos, parseTokEnd - context.pos), Token::LiteralString));
@@ -200,7 +310,7 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
         case '[':
         case ']':
         case ',':
-            outErrReason = constructYamlError(outLines.size(), context.lineBeginPos, context.pos, "NEO::Yaml : Inline collections are not supported yet");
+            outErrReason = constructYamlError(context.lineId, context.lineBeginPos, context.pos, "NEO::Yaml : Inline collections are not supported yet");
             return false;
         case ':':
             context.lineTraits.hasDictionaryEntry = true;
@@ -222,7 +332,7 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
                 if (tokEnd > context.pos) {
                     outTokens.push_back(Token(ConstStringRef(context.pos, tokEnd - context.pos), Token::LiteralNumber));
                 } else {
-                    outErrReason = constructYamlError(outLines.size(), context.lineBeginPos, context.pos, "Invalid numeric literal");
+                    outErrReason = constructYamlError(context.lineId, context.lineBeginPos, context.pos, "Invalid numeric literal");
                     return false;
                 }
             }
@@ -238,12 +348,20 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
     } else {
         if ('\n' != *outTokens.rbegin()) {
             outWarning.append("NEO::Yaml : text does not end with newline\n");
-            tokenizeEndLine(text, outLines, outTokens, outErrReason, outWarning, context);
+            if ((false == tokenizeEndLine(text, outTokens, outErrReason, outWarning, context)) && context.treeBuildFailed) {
+                return false;
+            }
         }
     }
     return true;
 }
 
+bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens, std::string &outErrReason, std::string &outWarning) {
+    TokenizerContext context{text};
+    context.outLines = &outLines;
+    return tokenize(text, outTokens, outErrReason, outWarning, context);
+}
+
 void finalizeNode(NodeId nodeId, const TokensCache &tokens, NodesCache &outNodes, std::string &outErrReason, std::string &outWarning) {
     auto &node = outNodes[nodeId];
     if (invalidTokenId != node.key) {
@@ -262,99 +380,48 @@ void finalizeNode(NodeId nodeId, const TokensCache &tokens, NodesCache &outNodes
     }
     UNRECOVERABLE_IF((colon == invalidTokenId) || (colon + 1 == valueTokenIt));
     UNRECOVERABLE_IF(invalidNodeID == node.lastChildId)
-    outNodes[node.lastChildId].nextSiblingId = static_cast<NodeId>(outNodes.size());
+    auto newNodeId = static_cast<NodeId>(outNodes.size());
+    auto newNodeKey = node.value;
+    outNodes[node.lastChildId].nextSiblingId = newNodeId;
+    node.lastChildId = newNodeId;
+    node.value = invalidTokenId;
+    ++node.numChildren;
 
     outNodes.resize(outNodes.size() + 1);
     auto &newNode = *outNodes.rbegin();
-    newNode.id = static_cast<NodeId>(outNodes.size() - 1);
+    newNode.id = newNodeId;
     newNode.parentId = nodeId;
-    node.lastChildId = outNodes.rbegin()->id;
-    newNode.key = node.value;
+    newNode.key = newNodeKey;
     newNode.value = colon + 1;
-
-    node.value = invalidTokenId;
-    ++node.numChildren;
 }
 
 bool buildTree(const LinesCache &lines, const TokensCache &tokens, NodesCache &outNodes, std::string &outErrReason, std::string &outWarning) {
-    StackVec<NodeId, 64> nesting;
-    size_t lineId = 0U;
-    outNodes.resize(1);
-    outNodes.rbegin()->id = 0U;
-    outNodes.rbegin()->firstChildId = 1U;
-    outNodes.rbegin()->lastChildId = 1U;
-    nesting.resize(1); // root
-
-    while (lineId < lines.size()) {
-        if (isUnused(lines[lineId].lineType)) {
-            ++lineId;
-            continue;
-        }
-
-        auto currLineIndent = lines[lineId].indent;
-        if (currLineIndent == outNodes.rbegin()->indent) {
-            auto &prev = *outNodes.rbegin();
-            auto &parent = outNodes[*nesting.rbegin()];
-            auto &curr = addNode(outNodes, prev, parent);
-            curr.indent = currLineIndent;
-        } else if (currLineIndent > outNodes.rbegin()->indent) {
-            auto &parent = *outNodes.rbegin();
-            auto &curr = addNode(outNodes, parent);
-            curr.indent = currLineIndent;
-            nesting.push_back(parent.id);
-        } else {
-            while (currLineIndent < outNodes[*nesting.rbegin()].indent) {
-                finalizeNode(*nesting.rbegin(), tokens, outNodes, outErrReason, outWarning);
-                UNRECOVERABLE_IF(nesting.empty());
-                nesting.pop_back();
-            }
-            bool hasInvalidIndent = (currLineIndent != outNodes[*nesting.rbegin()].indent);
-            if (hasInvalidIndent) {
-                outErrReason = constructYamlError(lineId, tokens[lines[lineId].first].pos, tokens[lines[lineId].first].pos + 1, "Invalid indentation");
-                return false;
-            } else {
-                auto &prev = outNodes[*nesting.rbegin()];
-                auto &parent = outNodes[prev.parentId];
-                auto &curr = addNode(outNodes, prev, parent);
-                curr.indent = currLineIndent;
-            }
-        }
-
-        if (lines[lineId].traits.hasInlineDataMarkers) {
-            outErrReason = "Inline collections are not supported yet\n";
+    TreeBuilder treeBuilder{tokens, outNodes};
+    for (size_t lineId = 0U; lineId < lines.size(); ++lineId) {
+        if (false == treeBuilder.addLine(lines[lineId], lineId, outErrReason, outWarning)) {
             return false;
-        } else {
-            if (Line::LineType::DictionaryEntry == lines[lineId].lineType) {
-                auto numTokensInLine = lines[lineId].last - lines[lineId].first + 1;
-                outNodes.rbegin()->key = lines[lineId].first;
-                UNRECOVERABLE_IF(numTokensInLine < 3); // at least key, : and \n
-                if (('#' != tokens[lines[lineId].first + 2]) && ('\n' != tokens[lines[lineId].first + 2])) {
-                    outNodes.rbegin()->value = lines[lineId].first + 2;
-                }
-            } else {
-                auto numTokensInLine = lines[lineId].last - lines[lineId].first + 1;
-                (void)numTokensInLine;
-                UNRECOVERABLE_IF(numTokensInLine < 2); // at least : - and \n
-                UNRECOVERABLE_IF(Line::LineType::ListEntry != lines[lineId].lineType);
-                UNRECOVERABLE_IF('-' != tokens[lines[lineId].first]);
-                if (('#' != tokens[lines[lineId].first + 1]) && ('\n' != tokens[lines[lineId].first + 1])) {
-                    outNodes.rbegin()->value = lines[lineId].first + 1;
-                }
-            }
-            ++lineId;
         }
     }
+    treeBuilder.finish(outErrReason, outWarning);
+    return true;
+}
 
-    while (false == nesting.empty()) {
-        finalizeNode(*nesting.rbegin(), tokens, outNodes, outErrReason, outWarning);
-        nesting.pop_back();
-    }
+void reserveForText(ConstStringRef text, TokensCache &outTokens, NodesCache &outNodes) {
+    auto numLines = static_cast<size_t>(std::count(text.begin(), text.end(), '\n')) + 1;
+    outTokens.reserve(numLines * estimatedTokensPerLine);
+    outNodes.reserve(numLines + 1);
+}
 
-    if (1U == outNodes.size()) {
-        outWarning.append("NEO::Yaml : Text has no data\n");
-        outNodes.clear();
-        return true;
+bool tokenizeAndBuildTree(ConstStringRef text, TokensCache &outTokens, NodesCache &outNodes, std::string &outErrReason, std::string &outWarning) {
+    reserveForText(text, outTokens, outNodes);
+
+    TreeBuilder treeBuilder{outTokens, outNodes};
+    TokenizerContext context{text};
+    context.treeBuilder = &treeBuilder;
+    if (false == tokenize(text, outTokens, outErrReason, outWarning, context)) {
+        return false;
     }
+    treeBuilder.finish(outErrReason, outWarning);
     return true;
 }
 
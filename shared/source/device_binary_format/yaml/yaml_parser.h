@@ -243,7 +243,7 @@ std::string constructYamlError(size_t lineNumber, const char *lineBeg, const cha
 
 bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens, std::string &outErrReason, std::string &outWarning);
 
-using NodeId = uint16_t;
+using NodeId = uint32_t;
 static constexpr NodeId invalidNodeID = std::numeric_limits<NodeId>::max();
 
 struct Node {
@@ -255,14 +255,14 @@ struct Node {
     NodeId firstChildId = invalidNodeID;
     NodeId lastChildId = invalidNodeID;
     NodeId nextSiblingId = invalidNodeID;
-    uint16_t numChildren = 0U;
+    uint32_t numChildren = 0U;
 
     Node() = default;
 
     explicit Node(uint32_t indent) : indent(indent) {
     }
 };
-static_assert(sizeof(Node) == 24, "");
+static_assert(sizeof(Node) == 36, "");
 using NodesCache = StackVec<Node, 512>;
 
 constexpr bool isUnused(Line::LineType lineType) {
@@ -280,6 +280,15 @@ constexpr bool isUnused(Line::LineType lineType) {
 
 bool buildTree(const LinesCache &lines, const TokensCache &tokens, NodesCache &outNodes, std::string &outErrReason, std::string &outWarning);
 
+// typical .ze_info line is "key: value\n"
+constexpr size_t estimatedTokensPerLine = 4U;
+
+void reserveForText(ConstStringRef text, TokensCache &outTokens, NodesCache &outNodes);
+
+// single pass variant of tokenize + buildTree - nodes are created as soon as each line is tokenized,
+// without materializing the LinesCache
+bool tokenizeAndBuildTree(ConstStringRef text, TokensCache &outTokens, NodesCache &outNodes, std::string &outErrReason, std::string &outWarning);
+
 inline const Node *findChildByKey(const Node &parent, const NodesCache &allNodes, const TokensCache &allTokens, const ConstStringRef key) {
     auto childId = parent.firstChildId;
     while (invalidNodeID != childId) {
@@ -406,8 +415,7 @@ struct YamlParser {
     }
 
     bool parse(const ConstStringRef text, std::string &outErrReason, std::string &outWarning) {
-        auto success = NEO::Yaml::tokenize(text, lines, tokens, outErrReason, outWarning);
-        success = success && NEO::Yaml::buildTree(lines, tokens, nodes, outErrReason, outWarning);
+        auto success = NEO::Yaml::tokenizeAndBuildTree(text, tokens, nodes, outErrReason, outWarning);
         if (false == success) {
             nodes.clear();
         }
@@ -476,7 +484,6 @@ struct YamlParser {
 
   protected:
     TokensCache tokens;
-    LinesCache lines;
     NodesCache nodes;
 };
 
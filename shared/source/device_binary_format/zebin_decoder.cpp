@@ -14,6 +14,7 @@
 #include "shared/source/device_binary_format/elf/elf_encoder.h"
 #include "shared/source/device_binary_format/elf/zebin_elf.h"
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
+#include "shared/source/program/parallel_kernel_decoding.h"
 #include "shared/source/program/program_info.h"
 #include "shared/source/utilities/compiler_support.h"
 #include "shared/source/utilities/stackvec.h"
@@ -21,6 +22,7 @@
 #include "opencl/source/program/kernel_info.h"
 
 #include <tuple>
+#include <vector>
 
 namespace NEO {
 
@@ -41,6 +43,8 @@ DecodeError extractZebinSections(NEO::Elf::Elf<Elf::EI_CLASS_64> &elf, ZebinSect
         case Elf::SHT_PROGBITS:
             if (sectionName.startsWith(NEO::Elf::SectionsNamesZebin::textPrefix.data())) {
                 out.textKernelSections.push_back(&elfSectionHeader);
+                auto kernelName = sectionName.substr(static_cast<int>(NEO::Elf::SectionsNamesZebin::textPrefix.length()));
+                out.textKernelSectionsByKernelName[kernelName] = &elfSectionHeader;
             } else if (sectionName == NEO::Elf::SectionsNamesZebin::dataConst) {
                 out.constDataSections.push_back(&elfSectionHeader);
             } else if (sectionName == ".data.global_const") {
@@ -859,21 +863,12 @@ NEO::DecodeError populateKernelDescriptor(NEO::ProgramInfo &dst, NEO::Elf::Elf<N
         kernelDescriptor.payloadMappings.bindingTable.tableOffset = static_cast<SurfaceStateHeapOffset>(generatedBindingTablePos - generatedSshPos);
     }
 
-    ZebinSections::SectionHeaderData *correspondingTextSegment = nullptr;
-    auto sectionHeaderNamesData = elf.sectionHeaders[elf.elfFileHeader->shStrNdx].data;
-    ConstStringRef sectionHeaderNamesString(reinterpret_cast<const char *>(sectionHeaderNamesData.begin()), sectionHeaderNamesData.size());
-    for (auto *textSection : zebinSections.textKernelSections) {
-        ConstStringRef sectionName = ConstStringRef(sectionHeaderNamesString.begin() + textSection->header->name);
-        auto sufix = sectionName.substr(static_cast<int>(NEO::Elf::SectionsNamesZebin::textPrefix.length()));
-        if (sufix == kernelDescriptor.kernelMetadata.kernelName) {
-            correspondingTextSegment = textSection;
-        }
-    }
-
-    if (nullptr == correspondingTextSegment) {
+    auto textSectionIt = zebinSections.textKernelSectionsByKernelName.find(kernelDescriptor.kernelMetadata.kernelName);
+    if (zebinSections.textKernelSectionsByKernelName.end() == textSectionIt) {
         outErrReason.append("Could not find text section for kernel " + kernelDescriptor.kernelMetadata.kernelName + "\n");
         return DecodeError::InvalidBinary;
     }
+    auto correspondingTextSegment = textSectionIt->second;
 
     kernelInfo->heapInfo.pKernelHeap = correspondingTextSegment->data.begin();
     kernelInfo->heapInfo.KernelHeapSize = static_cast<uint32_t>(correspondingTextSegment->data.size());
@@ -884,6 +879,35 @@ NEO::DecodeError populateKernelDescriptor(NEO::ProgramInfo &dst, NEO::Elf::Elf<N
     return DecodeError::Success;
 }
 
+NEO::DecodeError populateKernelDescriptorsInParallel(NEO::ProgramInfo &dst, NEO::Elf::Elf<NEO::Elf::EI_CLASS_64> &elf, NEO::ZebinSections &zebinSections,
+                                                     NEO::Yaml::YamlParser &yamlParser, const std::vector<const NEO::Yaml::Node *> &kernelNodes, uint32_t threadsCount,
+                                                     std::string &outErrReason, std::string &outWarning) {
+    struct KernelDecodingResult {
+        NEO::ProgramInfo programInfo;
+        std::string errReason;
+        std::string warning;
+        DecodeError error = DecodeError::Success;
+    };
+    std::vector<KernelDecodingResult> results(kernelNodes.size());
+    parallelFor(kernelNodes.size(), threadsCount, [&](size_t kernelId) {
+        auto &result = results[kernelId];
+        result.error = populateKernelDescriptor(result.programInfo, elf, zebinSections, yamlParser, *kernelNodes[kernelId], result.errReason, result.warning);
+    });
+
+    // Report the same messages as sequential decoding, which stops at the first failing kernel
+    dst.kernelInfos.reserve(dst.kernelInfos.size() + kernelNodes.size());
+    for (auto &result : results) {
+        outWarning.append(result.warning);
+        if (DecodeError::Success != result.error) {
+            outErrReason.append(result.errReason);
+            return result.error;
+        }
+        dst.kernelInfos.insert(dst.kernelInfos.end(), result.programInfo.kernelInfos.begin(), result.programInfo.kernelInfos.end());
+        result.programInfo.kernelInfos.clear();
+    }
+    return DecodeError::Success;
+}
+
 template <>
 DecodeError decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Zebin>(ProgramInfo &dst, const SingleDeviceBinary &src, std::string &outErrReason, std::string &outWarning) {
     auto elf = Elf::decodeElf<Elf::EI_CLASS_64>(src.deviceBinary, outErrReason, outWarning);
@@ -960,8 +984,18 @@ DecodeError decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Zebin>(ProgramInfo
         return DecodeError::Success;
     }
 
+    std::vector<const NEO::Yaml::Node *> kernelNodes;
     for (const auto &kernelNd : yamlParser.createChildrenRange(*kernelsSectionNodes[0])) {
-        auto zeInfoErr = populateKernelDescriptor(dst, elf, zebinSections, yamlParser, kernelNd, outErrReason, outWarning);
+        kernelNodes.push_back(&kernelNd);
+    }
+
+    auto threadsCount = ParallelKernelDecoding::getThreadsCount(kernelNodes.size());
+    if (threadsCount > 1) {
+        return populateKernelDescriptorsInParallel(dst, elf, zebinSections, yamlParser, kernelNodes, threadsCount, outErrReason, outWarning);
+    }
+
+    for (auto kernelNd : kernelNodes) {
+        auto zeInfoErr = populateKernelDescriptor(dst, elf, zebinSections, yamlParser, *kernelNd, outErrReason, outWarning);
         if (DecodeError::Success != zeInfoErr) {
             return zeInfoErr;
         }
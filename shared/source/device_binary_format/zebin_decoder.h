@@ -13,6 +13,8 @@
 #include "shared/source/utilities/stackvec.h"
 
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace NEO {
 
@@ -24,6 +26,7 @@ struct ZebinSections {
     StackVec<SectionHeaderData *, 1> constDataSections;
     StackVec<SectionHeaderData *, 1> symtabSections;
     StackVec<SectionHeaderData *, 1> spirvSections;
+    std::unordered_map<ConstStringRef, SectionHeaderData *, ConstStringRefHash> textKernelSectionsByKernelName;
 };
 
 using UniqueNode = StackVec<const NEO::Yaml::Node *, 1>;
@@ -89,4 +92,8 @@ NEO::DecodeError populateArgDescriptor(const NEO::Elf::ZebinKernelMetadata::Type
 
 NEO::DecodeError populateKernelDescriptor(NEO::ProgramInfo &dst, NEO::Elf::Elf<NEO::Elf::EI_CLASS_64> &elf, NEO::ZebinSections &zebinSections,
                                           NEO::Yaml::YamlParser &yamlParser, const NEO::Yaml::Node &kernelNd, std::string &outErrReason, std::string &outWarning);
+
+NEO::DecodeError populateKernelDescriptorsInParallel(NEO::ProgramInfo &dst, NEO::Elf::Elf<NEO::Elf::EI_CLASS_64> &elf, NEO::ZebinSections &zebinSections,
+                                                     NEO::Yaml::YamlParser &yamlParser, const std::vector<const NEO::Yaml::Node *> &kernelNodes, uint32_t threadsCount,
+                                                     std::string &outErrReason, std::string &outWarning);
 } // namespace NEO
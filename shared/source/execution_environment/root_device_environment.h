@@ -16,6 +16,7 @@
 namespace NEO {
 
 class AubCenter;
+class BindlessHeapsHelper;
 class BuiltIns;
 class CompilerInterface;
 class Debugger;
@@ -26,6 +27,7 @@ class GmmPageTableMngr;
 class HwDeviceId;
 class MemoryOperationsHandler;
 class OSInterface;
+class ScratchSpacePool;
 struct HardwareInfo;
 
 struct RootDeviceEnvironment {
@@ -60,6 +62,8 @@ struct RootDeviceEnvironment {
     std::unique_ptr<CompilerInterface> compilerInterface;
     std::unique_ptr<BuiltIns> builtins;
     std::unique_ptr<Debugger> debugger;
+    std::unique_ptr<BindlessHeapsHelper> bindlessHeapsHelper;
+    std::unique_ptr<ScratchSpacePool> scratchSpacePool;
     ExecutionEnvironment &executionEnvironment;
 
   private:
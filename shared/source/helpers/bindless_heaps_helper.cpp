@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/bindless_heaps_helper.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/engine_control.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
+
+#include <cstring>
+
+namespace NEO {
+
+BindlessHeapsHelper::BindlessHeapsHelper(MemoryManager *memoryManager, uint32_t rootDeviceIndex, DeviceBitfield deviceBitfield, size_t surfaceStateSize)
+    : memoryManager(memoryManager), surfaceStateSize(surfaceStateSize) {
+    heapAllocation = memoryManager->allocateGraphicsMemoryWithProperties({rootDeviceIndex, globalSshSize, GraphicsAllocation::AllocationType::SURFACE_STATE_HEAP, deviceBitfield});
+    UNRECOVERABLE_IF(heapAllocation == nullptr);
+    memset(heapAllocation->getUnderlyingBuffer(), 0, globalSshSize);
+}
+
+BindlessHeapsHelper::~BindlessHeapsHelper() {
+    memoryManager->freeGraphicsMemory(heapAllocation);
+}
+
+uint64_t BindlessHeapsHelper::getGlobalHeapGpuBase() const {
+    return heapAllocation->getGpuAddress();
+}
+
+size_t BindlessHeapsHelper::getUsedSlotsCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return heapUsed / surfaceStateSize - freeSurfaceStateOffsets.size();
+}
+
+SurfaceStateInHeapInfo BindlessHeapsHelper::allocateSSInHeap() {
+    std::lock_guard<std::mutex> lock(mtx);
+
+    if (freeSurfaceStateOffsets.empty()) {
+        reclaimReleasedSurfaceStates(false);
+    }
+    if (freeSurfaceStateOffsets.empty() && heapUsed + surfaceStateSize > globalSshSize) {
+        reclaimReleasedSurfaceStates(true);
+    }
+
+    SurfaceStateInHeapInfo info;
+    if (!freeSurfaceStateOffsets.empty()) {
+        info.surfaceStateOffset = freeSurfaceStateOffsets.back();
+        freeSurfaceStateOffsets.pop_back();
+    } else {
+        UNRECOVERABLE_IF(heapUsed + surfaceStateSize > globalSshSize);
+        info.surfaceStateOffset = static_cast<uint32_t>(heapUsed);
+        heapUsed += surfaceStateSize;
+    }
+    info.ssPtr = ptrOffset(heapAllocation->getUnderlyingBuffer(), info.surfaceStateOffset);
+    return info;
+}
+
+void BindlessHeapsHelper::releaseSSInHeap(uint32_t surfaceStateOffset) {
+    std::lock_guard<std::mutex> lock(mtx);
+    DEBUG_BREAK_IF(surfaceStateOffset >= heapUsed);
+
+    // heap is resident in every submission, so its task counts cover all work that may reference the slot
+    ReleasedSurfaceState releasedSurfaceState{surfaceStateOffset, {}};
+    for (auto &engine : memoryManager->getRegisteredEngines()) {
+        auto osContextId = engine.osContext->getContextId();
+        auto heapTaskCount = heapAllocation->getTaskCount(osContextId);
+        if (heapAllocation->isUsedByOsContext(osContextId) && heapTaskCount > *engine.commandStreamReceiver->getTagAddress()) {
+            releasedSurfaceState.contextTaskCounts.push_back({osContextId, heapTaskCount});
+        }
+    }
+
+    if (releasedSurfaceState.contextTaskCounts.empty()) {
+        freeSurfaceStateOffsets.push_back(surfaceStateOffset);
+    } else {
+        releasedSurfaceStates.push_back(std::move(releasedSurfaceState));
+    }
+}
+
+void BindlessHeapsHelper::reclaimReleasedSurfaceStates(bool waitForCompletion) {
+    auto &engines = memoryManager->getRegisteredEngines();
+    auto isCompleted = [&](const ReleasedSurfaceState &releasedSurfaceState) {
+        for (auto &contextTaskCount : releasedSurfaceState.contextTaskCounts) {
+            for (auto &engine : engines) {
+                if (engine.osContext->getContextId() != contextTaskCount.first ||
+                    *engine.commandStreamReceiver->getTagAddress() >= contextTaskCount.second) {
+                    continue;
+                }
+                if (!waitForCompletion) {
+                    return false;
+                }
+                engine.commandStreamReceiver->waitForCompletionWithTimeout(false, TimeoutControls::maxTimeout, contextTaskCount.second);
+            }
+        }
+        return true;
+    };
+
+    auto it = releasedSurfaceStates.begin();
+    while (it != releasedSurfaceStates.end()) {
+        if (isCompleted(*it)) {
+            freeSurfaceStateOffsets.push_back(it->surfaceStateOffset);
+            it = releasedSurfaceStates.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+} // namespace NEO
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/common_types.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+class GraphicsAllocation;
+class MemoryManager;
+
+struct SurfaceStateInHeapInfo {
+    void *ssPtr = nullptr;
+    uint32_t surfaceStateOffset = 0u;
+};
+
+// Global heap of surface states addressed by bindless offsets. Slots hold immutable surface states: an owner
+// obtains a slot once, programs it and releases it when it is no longer needed, so dispatches only need to patch
+// slot offsets instead of copying surface states into a per-dispatch heap. Released slots are reused only after
+// all submissions made with the heap before the release have completed.
+class BindlessHeapsHelper : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t globalSshSize = 4 * MemoryConstants::megaByte;
+
+    BindlessHeapsHelper(MemoryManager *memoryManager, uint32_t rootDeviceIndex, DeviceBitfield deviceBitfield, size_t surfaceStateSize);
+    ~BindlessHeapsHelper();
+
+    SurfaceStateInHeapInfo allocateSSInHeap();
+    void releaseSSInHeap(uint32_t surfaceStateOffset);
+
+    GraphicsAllocation *getHeapAllocation() const { return heapAllocation; }
+    uint64_t getGlobalHeapGpuBase() const;
+    size_t getHeapSize() const { return globalSshSize; }
+    size_t getSurfaceStateSize() const { return surfaceStateSize; }
+    size_t getUsedSlotsCount() const;
+
+  protected:
+    struct ReleasedSurfaceState {
+        uint32_t surfaceStateOffset;
+        std::vector<std::pair<uint32_t, uint32_t>> contextTaskCounts;
+    };
+
+    void reclaimReleasedSurfaceStates(bool waitForCompletion);
+
+    MemoryManager *memoryManager = nullptr;
+    GraphicsAllocation *heapAllocation = nullptr;
+    size_t surfaceStateSize = 0u;
+    size_t heapUsed = 0u;
+    std::vector<uint32_t> freeSurfaceStateOffsets;
+    std::vector<ReleasedSurfaceState> releasedSurfaceStates;
+    mutable std::mutex mtx;
+};
+} // namespace NEO
@@ -41,6 +41,11 @@ struct StateBaseAddressHelper {
         GmmHelper *gmmHelper,
         bool isMultiOsContextCapable);
 
+    static void programBindlessSurfaceStateBaseAddress(
+        STATE_BASE_ADDRESS *stateBaseAddress,
+        uint64_t bindlessSurfaceStateBaseAddress,
+        size_t bindlessSurfaceStateHeapSize);
+
     static void programBindingTableBaseAddress(LinearStream &commandStream, const IndirectHeap &ssh, GmmHelper *gmmHelper);
 };
 } // namespace NEO
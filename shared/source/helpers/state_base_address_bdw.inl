@@ -19,4 +19,11 @@ void StateBaseAddressHelper<GfxFamily>::appendStateBaseAddressParameters(
     bool isMultiOsContextCapable) {
 }
 
+template <typename GfxFamily>
+void StateBaseAddressHelper<GfxFamily>::programBindlessSurfaceStateBaseAddress(
+    STATE_BASE_ADDRESS *stateBaseAddress,
+    uint64_t bindlessSurfaceStateBaseAddress,
+    size_t bindlessSurfaceStateHeapSize) {
+}
+
 } // namespace NEO
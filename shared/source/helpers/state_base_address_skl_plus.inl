@@ -19,11 +19,20 @@ void StateBaseAddressHelper<GfxFamily>::appendStateBaseAddressParameters(
     bool isMultiOsContextCapable) {
 
     if (ssh) {
-        stateBaseAddress->setBindlessSurfaceStateBaseAddressModifyEnable(true);
-        stateBaseAddress->setBindlessSurfaceStateBaseAddress(ssh->getHeapGpuBase());
-        uint32_t size = uint32_t(ssh->getMaxAvailableSpace() / 64) - 1;
-        stateBaseAddress->setBindlessSurfaceStateSize(size);
+        programBindlessSurfaceStateBaseAddress(stateBaseAddress, ssh->getHeapGpuBase(), ssh->getMaxAvailableSpace());
     }
 }
 
+template <typename GfxFamily>
+void StateBaseAddressHelper<GfxFamily>::programBindlessSurfaceStateBaseAddress(
+    STATE_BASE_ADDRESS *stateBaseAddress,
+    uint64_t bindlessSurfaceStateBaseAddress,
+    size_t bindlessSurfaceStateHeapSize) {
+
+    stateBaseAddress->setBindlessSurfaceStateBaseAddressModifyEnable(true);
+    stateBaseAddress->setBindlessSurfaceStateBaseAddress(bindlessSurfaceStateBaseAddress);
+    uint32_t size = uint32_t(bindlessSurfaceStateHeapSize / 64) - 1;
+    stateBaseAddress->setBindlessSurfaceStateSize(size);
+}
+
 } // namespace NEO
@@ -15,6 +15,7 @@ namespace NEO {
 
 struct OsHandle;
 struct ResidencyData;
+struct FragmentStorage;
 
 using OsGraphicsHandle = OsHandle;
 
@@ -44,6 +45,8 @@ struct PartialAllocation {
     FragmentPosition fragmentPosition = FragmentPosition::NONE;
     const void *allocationPtr = nullptr;
     size_t allocationSize = 0u;
+    OverlapStatus overlapStatus = OverlapStatus::FRAGMENT_NOT_CHECKED;
+    FragmentStorage *overlappedFragment = nullptr;
 };
 
 struct AllocationRequirements {
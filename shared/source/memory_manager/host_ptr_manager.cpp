@@ -12,28 +12,21 @@
 using namespace NEO;
 
 HostPtrFragmentsContainer::iterator HostPtrManager::findElement(HostPtrEntryKey key) {
-    auto nextElement = partialAllocations.lower_bound(key);
-    auto element = nextElement;
-    if (element != partialAllocations.end()) {
-
-        auto &storedFragment = element->second;
-        if (element->first.rootDeviceIndex == key.rootDeviceIndex && storedFragment.fragmentCpuPointer == key.ptr) {
-            return element;
-        }
+    auto element = partialAllocations.upper_bound(key);
+    if (element == partialAllocations.begin()) {
+        return partialAllocations.end();
     }
-    if (element != partialAllocations.begin()) {
-        element--;
-        if (element->first.rootDeviceIndex != key.rootDeviceIndex) {
-            return partialAllocations.end();
-        }
-        auto &storedFragment = element->second;
-        auto storedEndAddress = reinterpret_cast<uintptr_t>(storedFragment.fragmentCpuPointer) + storedFragment.fragmentSize;
-        if (storedFragment.fragmentSize == 0) {
-            storedEndAddress++;
-        }
-        if (reinterpret_cast<uintptr_t>(key.ptr) < storedEndAddress) {
-            return element;
-        }
+    element--;
+    if (element->first.rootDeviceIndex != key.rootDeviceIndex) {
+        return partialAllocations.end();
+    }
+    auto &storedFragment = element->second;
+    if (storedFragment.fragmentCpuPointer == key.ptr) {
+        return element;
+    }
+    auto storedEndAddress = reinterpret_cast<uintptr_t>(storedFragment.fragmentCpuPointer) + storedFragment.fragmentSize;
+    if (reinterpret_cast<uintptr_t>(key.ptr) < storedEndAddress) {
+        return element;
     }
     return partialAllocations.end();
 }
@@ -88,9 +81,12 @@ AllocationRequirements HostPtrManager::getAllocationRequirements(uint32_t rootDe
 OsHandleStorage HostPtrManager::populateAlreadyAllocatedFragments(AllocationRequirements &requirements) {
     OsHandleStorage handleStorage;
     for (unsigned int i = 0; i < requirements.requiredFragmentsCount; i++) {
-        OverlapStatus overlapStatus = OverlapStatus::FRAGMENT_NOT_CHECKED;
-        FragmentStorage *fragmentStorage = getFragmentAndCheckForOverlaps(requirements.rootDeviceIndex, const_cast<void *>(requirements.allocationFragments[i].allocationPtr),
-                                                                          requirements.allocationFragments[i].allocationSize, overlapStatus);
+        OverlapStatus overlapStatus = requirements.allocationFragments[i].overlapStatus;
+        FragmentStorage *fragmentStorage = requirements.allocationFragments[i].overlappedFragment;
+        if (overlapStatus == OverlapStatus::FRAGMENT_NOT_CHECKED) {
+            fragmentStorage = getFragmentAndCheckForOverlaps(requirements.rootDeviceIndex, requirements.allocationFragments[i].allocationPtr,
+                                                             requirements.allocationFragments[i].allocationSize, overlapStatus);
+        }
         if (overlapStatus == OverlapStatus::FRAGMENT_WITHIN_STORED_FRAGMENT) {
             UNRECOVERABLE_IF(fragmentStorage == nullptr);
             fragmentStorage->refCount++;
@@ -181,66 +177,43 @@ FragmentStorage *HostPtrManager::getFragment(HostPtrEntryKey key) {
 //for given inputs see if any allocation overlaps
 FragmentStorage *HostPtrManager::getFragmentAndCheckForOverlaps(uint32_t rootDeviceIndex, const void *inPtr, size_t size, OverlapStatus &overlappingStatus) {
     std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
-    void *inputPtr = const_cast<void *>(inPtr);
-    auto nextElement = partialAllocations.lower_bound({inputPtr, rootDeviceIndex});
-    auto element = nextElement;
     overlappingStatus = OverlapStatus::FRAGMENT_NOT_OVERLAPING_WITH_ANY_OTHER;
 
-    if (element != partialAllocations.begin()) {
-        element--;
-    }
-
-    if (element != partialAllocations.end()) {
-        if (element->first.rootDeviceIndex != rootDeviceIndex) {
-            return nullptr;
-        }
-        auto &storedFragment = element->second;
-        if (storedFragment.fragmentCpuPointer == inputPtr && storedFragment.fragmentSize == size) {
-            overlappingStatus = OverlapStatus::FRAGMENT_WITH_EXACT_SIZE_AS_STORED_FRAGMENT;
-            return &element->second;
-        }
-
-        auto storedEndAddress = (uintptr_t)storedFragment.fragmentCpuPointer + storedFragment.fragmentSize;
-        auto inputEndAddress = (uintptr_t)inputPtr + size;
-
-        if (inputPtr >= storedFragment.fragmentCpuPointer && (uintptr_t)inputPtr < (uintptr_t)storedEndAddress) {
-            if (inputEndAddress <= storedEndAddress) {
-                overlappingStatus = OverlapStatus::FRAGMENT_WITHIN_STORED_FRAGMENT;
-                return &element->second;
-            } else {
-                overlappingStatus = OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT;
-                return nullptr;
-            }
-        }
-        //next fragment doesn't have to be after the inputPtr
-        if (nextElement != partialAllocations.end()) {
-            if (nextElement->first.rootDeviceIndex != rootDeviceIndex) {
-                return nullptr;
-            }
-            auto &storedNextElement = nextElement->second;
-            auto storedNextEndAddress = (uintptr_t)storedNextElement.fragmentCpuPointer + storedNextElement.fragmentSize;
-            auto storedNextStartAddress = (uintptr_t)storedNextElement.fragmentCpuPointer;
-            //check if this allocation is after the inputPtr
-            if ((uintptr_t)inputPtr < storedNextStartAddress) {
-                if (inputEndAddress > storedNextStartAddress) {
-                    overlappingStatus = OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT;
-                    return nullptr;
+    //stored fragments never overlap each other, so single descent is enough:
+    //the only candidate for containing inputPtr is the last fragment starting at or before it
+    //and the only candidate for overlapping the tail of the input range is the first fragment after it
+    auto inputStartAddress = reinterpret_cast<uintptr_t>(inPtr);
+    auto inputEndAddress = inputStartAddress + size;
+    auto nextElement = partialAllocations.upper_bound({inPtr, rootDeviceIndex});
+
+    if (nextElement != partialAllocations.begin()) {
+        auto element = std::prev(nextElement);
+        if (element->first.rootDeviceIndex == rootDeviceIndex) {
+            auto &storedFragment = element->second;
+            auto storedStartAddress = reinterpret_cast<uintptr_t>(storedFragment.fragmentCpuPointer);
+            auto storedEndAddress = storedStartAddress + storedFragment.fragmentSize;
+
+            if (inputStartAddress == storedStartAddress || inputStartAddress < storedEndAddress) {
+                if (inputStartAddress == storedStartAddress && inputEndAddress == storedEndAddress) {
+                    overlappingStatus = OverlapStatus::FRAGMENT_WITH_EXACT_SIZE_AS_STORED_FRAGMENT;
+                    return &storedFragment;
                 }
-            } else if (inputEndAddress > storedNextEndAddress) {
-                overlappingStatus = OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT;
-                return nullptr;
-            } else {
-                DEBUG_BREAK_IF((uintptr_t)inputPtr != storedNextStartAddress);
-                if (inputEndAddress < storedNextEndAddress) {
+                if (inputEndAddress <= storedEndAddress) {
                     overlappingStatus = OverlapStatus::FRAGMENT_WITHIN_STORED_FRAGMENT;
-                } else {
-                    DEBUG_BREAK_IF(inputEndAddress != storedNextEndAddress);
-                    overlappingStatus = OverlapStatus::FRAGMENT_WITH_EXACT_SIZE_AS_STORED_FRAGMENT;
+                    return &storedFragment;
                 }
-                return &nextElement->second;
+                overlappingStatus = OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT;
+                return nullptr;
             }
         }
     }
+
+    if (nextElement != partialAllocations.end() && nextElement->first.rootDeviceIndex == rootDeviceIndex) {
+        auto storedNextStartAddress = reinterpret_cast<uintptr_t>(nextElement->second.fragmentCpuPointer);
+        if (inputEndAddress > storedNextStartAddress) {
+            overlappingStatus = OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT;
+        }
+    }
     return nullptr;
 }
 
@@ -266,29 +239,37 @@ RequirementsStatus HostPtrManager::checkAllocationsForOverlapping(MemoryManager
     for (unsigned int i = 0; i < requirements->requiredFragmentsCount; i++) {
         OverlapStatus overlapStatus = OverlapStatus::FRAGMENT_NOT_CHECKED;
 
-        getFragmentAndCheckForOverlaps(requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
-                                       requirements->allocationFragments[i].allocationSize, overlapStatus);
+        auto overlappedFragment = getFragmentAndCheckForOverlaps(requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
+                                                                 requirements->allocationFragments[i].allocationSize, overlapStatus);
         if (overlapStatus == OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT) {
+            // fragments checked so far may be released by cleaning below, forget their results
+            for (unsigned int j = 0; j < i; j++) {
+                requirements->allocationFragments[j].overlapStatus = OverlapStatus::FRAGMENT_NOT_CHECKED;
+                requirements->allocationFragments[j].overlappedFragment = nullptr;
+            }
+
             // clean temporary allocations
             memoryManager.cleanTemporaryAllocationListOnAllEngines(false);
 
             // check overlapping again
-            getFragmentAndCheckForOverlaps(requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
-                                           requirements->allocationFragments[i].allocationSize, overlapStatus);
+            overlappedFragment = getFragmentAndCheckForOverlaps(requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
+                                                                requirements->allocationFragments[i].allocationSize, overlapStatus);
             if (overlapStatus == OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT) {
 
                 // Wait for completion
                 memoryManager.cleanTemporaryAllocationListOnAllEngines(true);
 
                 // check overlapping last time
-                getFragmentAndCheckForOverlaps(requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
-                                               requirements->allocationFragments[i].allocationSize, overlapStatus);
+                overlappedFragment = getFragmentAndCheckForOverlaps(requirements->rootDeviceIndex, requirements->allocationFragments[i].allocationPtr,
+                                                                    requirements->allocationFragments[i].allocationSize, overlapStatus);
                 if (overlapStatus == OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT) {
                     status = RequirementsStatus::FATAL;
                     break;
                 }
             }
         }
+        requirements->allocationFragments[i].overlapStatus = overlapStatus;
+        requirements->allocationFragments[i].overlappedFragment = overlappedFragment;
     }
     return status;
 }
@@ -8,6 +8,7 @@
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/memory_manager/host_ptr_manager.h"
 #include "shared/source/os_interface/os_context.h"
 
@@ -16,7 +17,14 @@ namespace NEO {
 InternalAllocationStorage::InternalAllocationStorage(CommandStreamReceiver &commandStreamReceiver)
     : commandStreamReceiver(commandStreamReceiver),
       temporaryAllocations(TEMPORARY_ALLOCATION),
-      allocationsForReuse(REUSABLE_ALLOCATION){};
+      allocationsForReuse(REUSABLE_ALLOCATION) {
+    if (DebugManager.flags.EnableReusableAllocationsPool.get() == 1) {
+        reusableAllocationsPool = std::make_unique<ReusableAllocationsPool>(*commandStreamReceiver.getMemoryManager());
+        if (DebugManager.flags.ReusableAllocationsPoolBudgetInMb.get() != -1) {
+            reusableAllocationsBudget = static_cast<size_t>(DebugManager.flags.ReusableAllocationsPoolBudgetInMb.get() * MemoryConstants::megaByte);
+        }
+    }
+};
 
 void InternalAllocationStorage::storeAllocation(std::unique_ptr<GraphicsAllocation> gfxAllocation, uint32_t allocationUsage) {
     uint32_t taskCount = gfxAllocation->getTaskCount(commandStreamReceiver.getOsContext().getContextId());
@@ -33,6 +41,15 @@ void InternalAllocationStorage::storeAllocationWithTaskCount(std::unique_ptr<Gra
             commandStreamReceiver.getMemoryManager()->freeGraphicsMemory(gfxAllocation.release());
             return;
         }
+        if (reusableAllocationsPool) {
+            gfxAllocation->updateTaskCount(taskCount, commandStreamReceiver.getOsContext().getContextId());
+            reusableAllocationsPool->storeAllocation(std::move(gfxAllocation), taskCount);
+            if (reusableAllocationsPool->getPooledSize() > reusableAllocationsBudget) {
+                auto lock = commandStreamReceiver.getMemoryManager()->getHostPtrManager()->obtainOwnership();
+                reusableAllocationsPool->trimToBudget(reusableAllocationsBudget, *commandStreamReceiver.getTagAddress());
+            }
+            return;
+        }
     }
     auto &allocationsList = (allocationUsage == TEMPORARY_ALLOCATION) ? temporaryAllocations : allocationsForReuse;
     gfxAllocation->updateTaskCount(taskCount, commandStreamReceiver.getOsContext().getContextId());
@@ -41,6 +58,10 @@ void InternalAllocationStorage::storeAllocationWithTaskCount(std::unique_ptr<Gra
 
 void InternalAllocationStorage::cleanAllocationList(uint32_t waitTaskCount, uint32_t allocationUsage) {
     freeAllocationsList(waitTaskCount, (allocationUsage == TEMPORARY_ALLOCATION) ? temporaryAllocations : allocationsForReuse);
+    if (allocationUsage == REUSABLE_ALLOCATION && reusableAllocationsPool) {
+        auto lock = commandStreamReceiver.getMemoryManager()->getHostPtrManager()->obtainOwnership();
+        reusableAllocationsPool->freeAllocations(waitTaskCount);
+    }
 }
 
 void InternalAllocationStorage::freeAllocationsList(uint32_t waitTaskCount, AllocationsList &allocationsList) {
@@ -66,6 +87,9 @@ void InternalAllocationStorage::freeAllocationsList(uint32_t waitTaskCount, Allo
 }
 
 std::unique_ptr<GraphicsAllocation> InternalAllocationStorage::obtainReusableAllocation(size_t requiredSize, GraphicsAllocation::AllocationType allocationType) {
+    if (reusableAllocationsPool) {
+        return reusableAllocationsPool->obtainAllocation(requiredSize, allocationType, *commandStreamReceiver.getTagAddress());
+    }
     auto allocation = allocationsForReuse.detachAllocation(requiredSize, nullptr, commandStreamReceiver, allocationType);
     return allocation;
 }
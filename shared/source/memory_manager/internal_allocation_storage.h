@@ -8,6 +8,9 @@
 #pragma once
 #include "shared/source/helpers/common_types.h"
 #include "shared/source/memory_manager/allocations_list.h"
+#include "shared/source/memory_manager/reusable_allocations_pool.h"
+
+#include <memory>
 
 namespace NEO {
 
@@ -22,6 +25,7 @@ class InternalAllocationStorage {
     std::unique_ptr<GraphicsAllocation> obtainTemporaryAllocationWithPtr(size_t requiredSize, const void *requiredPtr, GraphicsAllocation::AllocationType allocationType);
     AllocationsList &getTemporaryAllocations() { return temporaryAllocations; }
     AllocationsList &getAllocationsForReuse() { return allocationsForReuse; }
+    ReusableAllocationsPool *getReusableAllocationsPool() { return reusableAllocationsPool.get(); }
     DeviceBitfield getDeviceBitfield() const;
 
   protected:
@@ -30,5 +34,7 @@ class InternalAllocationStorage {
 
     AllocationsList temporaryAllocations;
     AllocationsList allocationsForReuse;
+    std::unique_ptr<ReusableAllocationsPool> reusableAllocationsPool;
+    size_t reusableAllocationsBudget = std::numeric_limits<size_t>::max();
 };
 } // namespace NEO
@@ -19,6 +19,7 @@
 #include "shared/source/helpers/heap_assigner.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/helpers/surface_format_info.h"
 #include "shared/source/memory_manager/deferrable_allocation_deletion.h"
@@ -28,6 +29,7 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/utilities/compiler_support.h"
+#include "shared/source/utilities/cpu_copy_engine.h"
 #include "shared/source/utilities/stackvec.h"
 
 #include <algorithm>
@@ -222,6 +224,11 @@ bool MemoryManager::isAsyncDeleterEnabled() const {
     return asyncDeleterEnabled;
 }
 
+CpuCopyEngine *MemoryManager::getCpuCopyEngine() {
+    std::call_once(cpuCopyEngineCreated, [this]() { cpuCopyEngine = CpuCopyEngine::create(); });
+    return cpuCopyEngine.get();
+}
+
 bool MemoryManager::isLocalMemorySupported(uint32_t rootDeviceIndex) const {
     return localMemorySupported[rootDeviceIndex];
 }
@@ -538,11 +545,12 @@ HeapIndex MemoryManager::selectHeap(const GraphicsAllocation *allocation, bool h
     return HeapIndex::HEAP_STANDARD;
 }
 
-bool MemoryManager::copyMemoryToAllocation(GraphicsAllocation *graphicsAllocation, const void *memoryToCopy, size_t sizeToCopy) {
+bool MemoryManager::copyMemoryToAllocation(GraphicsAllocation *graphicsAllocation, size_t destinationOffset, const void *memoryToCopy, size_t sizeToCopy) {
     if (!graphicsAllocation->getUnderlyingBuffer()) {
         return false;
     }
-    memcpy_s(graphicsAllocation->getUnderlyingBuffer(), graphicsAllocation->getUnderlyingBufferSize(), memoryToCopy, sizeToCopy);
+    memcpy_s(ptrOffset(graphicsAllocation->getUnderlyingBuffer(), destinationOffset),
+             (graphicsAllocation->getUnderlyingBufferSize() - destinationOffset), memoryToCopy, sizeToCopy);
     return true;
 }
 
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/reusable_allocations_pool.h"
+
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/memory_manager/memory_manager.h"
+
+#include <iterator>
+#include <limits>
+
+namespace NEO {
+
+ReusableAllocationsPool::~ReusableAllocationsPool() {
+    freeAllocations(std::numeric_limits<uint32_t>::max());
+}
+
+uint32_t ReusableAllocationsPool::getBucketIndex(size_t size) {
+    if (size == 0u) {
+        return 0u;
+    }
+    return Math::log2(static_cast<uint64_t>(size));
+}
+
+void ReusableAllocationsPool::storeAllocation(std::unique_ptr<GraphicsAllocation> allocation, uint32_t taskCount) {
+    auto size = allocation->getUnderlyingBufferSize();
+    BucketKey key{getBucketIndex(size), allocation->getAllocationType()};
+
+    std::lock_guard<std::mutex> lock(mutex);
+    buckets[key].emplace(taskCount, allocation.release());
+    pooledSize += size;
+    allocationsCount++;
+}
+
+std::unique_ptr<GraphicsAllocation> ReusableAllocationsPool::obtainAllocation(size_t requiredMinimalSize, GraphicsAllocation::AllocationType allocationType, uint32_t completedTaskCount) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (allocationsCount == 0u) {
+        return nullptr;
+    }
+
+    // only the lowest bucket may hold allocations smaller than required, any completed allocation from higher buckets fits
+    for (auto bucketIndex = getBucketIndex(requiredMinimalSize); bucketIndex < bucketsCount; bucketIndex++) {
+        auto bucketIt = buckets.find(BucketKey{bucketIndex, allocationType});
+        if (bucketIt == buckets.end()) {
+            continue;
+        }
+        auto &bucket = bucketIt->second;
+        for (auto allocationIt = bucket.begin(); allocationIt != bucket.end() && allocationIt->first <= completedTaskCount; ++allocationIt) {
+            auto allocation = allocationIt->second;
+            if (allocation->getUnderlyingBufferSize() >= requiredMinimalSize) {
+                removeFromPool(bucketIt, allocationIt);
+                return std::unique_ptr<GraphicsAllocation>(allocation);
+            }
+        }
+    }
+    return nullptr;
+}
+
+void ReusableAllocationsPool::freeAllocations(uint32_t waitTaskCount) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto bucketIt = buckets.begin(); bucketIt != buckets.end();) {
+        auto &bucket = bucketIt->second;
+        auto completedEnd = bucket.upper_bound(waitTaskCount);
+        for (auto allocationIt = bucket.begin(); allocationIt != completedEnd; ++allocationIt) {
+            pooledSize -= allocationIt->second->getUnderlyingBufferSize();
+            allocationsCount--;
+            memoryManager.freeGraphicsMemory(allocationIt->second);
+        }
+        bucket.erase(bucket.begin(), completedEnd);
+        bucketIt = bucket.empty() ? buckets.erase(bucketIt) : std::next(bucketIt);
+    }
+}
+
+void ReusableAllocationsPool::trimToBudget(size_t budget, uint32_t completedTaskCount) {
+    std::lock_guard<std::mutex> lock(mutex);
+    // largest buckets are released first, so the fewest allocations are freed to get within the budget
+    for (auto bucketIt = buckets.rbegin(); (bucketIt != buckets.rend()) && (pooledSize > budget);) {
+        auto &bucket = bucketIt->second;
+        while (!bucket.empty() && (bucket.begin()->first <= completedTaskCount) && (pooledSize > budget)) {
+            auto allocation = bucket.begin()->second;
+            pooledSize -= allocation->getUnderlyingBufferSize();
+            allocationsCount--;
+            bucket.erase(bucket.begin());
+            memoryManager.freeGraphicsMemory(allocation);
+        }
+        if (bucket.empty()) {
+            bucketIt = BucketsMap::reverse_iterator(buckets.erase(std::next(bucketIt).base()));
+        } else {
+            ++bucketIt;
+        }
+    }
+}
+
+void ReusableAllocationsPool::removeFromPool(BucketsMap::iterator bucketIt, Bucket::iterator allocationIt) {
+    pooledSize -= allocationIt->second->getUnderlyingBufferSize();
+    allocationsCount--;
+    bucketIt->second.erase(allocationIt);
+    if (bucketIt->second.empty()) {
+        buckets.erase(bucketIt);
+    }
+}
+
+} // namespace NEO
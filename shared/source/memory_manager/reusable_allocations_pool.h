@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace NEO {
+class MemoryManager;
+
+// Reusable allocations bucketed by type and power-of-two size. Allocations within a bucket are ordered by
+// the task count of their last usage, so a completed allocation of sufficient size is found without walking
+// all stored allocations.
+class ReusableAllocationsPool : NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t bucketsCount = 64u;
+
+    ReusableAllocationsPool(MemoryManager &memoryManager) : memoryManager(memoryManager) {}
+    ~ReusableAllocationsPool();
+
+    void storeAllocation(std::unique_ptr<GraphicsAllocation> allocation, uint32_t taskCount);
+    std::unique_ptr<GraphicsAllocation> obtainAllocation(size_t requiredMinimalSize, GraphicsAllocation::AllocationType allocationType, uint32_t completedTaskCount);
+    void freeAllocations(uint32_t waitTaskCount);
+    void trimToBudget(size_t budget, uint32_t completedTaskCount);
+
+    size_t getPooledSize() const { return pooledSize; }
+    size_t getAllocationsCount() const { return allocationsCount; }
+    bool isEmpty() const { return allocationsCount == 0u; }
+
+    static uint32_t getBucketIndex(size_t size);
+
+  protected:
+    using Bucket = std::multimap<uint32_t, GraphicsAllocation *>;
+    using BucketKey = std::pair<uint32_t, GraphicsAllocation::AllocationType>;
+    using BucketsMap = std::map<BucketKey, Bucket>;
+
+    void removeFromPool(BucketsMap::iterator bucketIt, Bucket::iterator allocationIt);
+
+    MemoryManager &memoryManager;
+    BucketsMap buckets;
+    size_t pooledSize = 0u;
+    size_t allocationsCount = 0u;
+    std::mutex mutex;
+};
+} // namespace NEO
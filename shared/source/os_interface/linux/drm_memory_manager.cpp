@@ -49,6 +49,12 @@ DrmMemoryManager::DrmMemoryManager(gemCloseWorkerMode mode,
         getGfxPartition(rootDeviceIndex)->init(gpuAddressSpace, getSizeToReserve(), rootDeviceIndex, gfxPartitions.size());
     }
     MemoryManager::virtualPaddingAvailable = true;
+    if (DebugManager.flags.EnableUserptrCache.get() == 1) {
+        userptrCacheMaxSize = static_cast<size_t>(64 * MemoryConstants::megaByte);
+        if (DebugManager.flags.UserptrCacheMaxSizeInMb.get() != -1) {
+            userptrCacheMaxSize = static_cast<size_t>(DebugManager.flags.UserptrCacheMaxSizeInMb.get() * MemoryConstants::megaByte);
+        }
+    }
     if (mode != gemCloseWorkerMode::gemCloseWorkerInactive) {
         gemCloseWorker.reset(new DrmGemCloseWorker(*this));
     }
@@ -89,6 +95,8 @@ DrmMemoryManager::~DrmMemoryManager() {
 }
 
 void DrmMemoryManager::commonCleanup() {
+    releaseUserptrCache();
+
     if (gemCloseWorker) {
         gemCloseWorker->close(false);
     }
@@ -188,6 +196,66 @@ NEO::BufferObject *DrmMemoryManager::allocUserptr(uintptr_t address, size_t size
     return res;
 }
 
+BufferObject *DrmMemoryManager::obtainUserptrFromCache(uintptr_t address, size_t size, uint32_t rootDeviceIndex) {
+    std::lock_guard<std::mutex> lock(userptrCacheMutex);
+    auto indexEntry = userptrCacheIndex.find(UserptrCacheKey{rootDeviceIndex, address, size});
+    if (indexEntry == userptrCacheIndex.end()) {
+        return nullptr;
+    }
+    auto bo = indexEntry->second->bo;
+    userptrCacheSize -= size;
+    userptrCache.erase(indexEntry->second);
+    userptrCacheIndex.erase(indexEntry);
+    return bo;
+}
+
+bool DrmMemoryManager::storeUserptrInCache(BufferObject *bo, uintptr_t address, size_t size, uint32_t rootDeviceIndex) {
+    if (size > userptrCacheMaxSize) {
+        return false;
+    }
+    std::vector<BufferObject *> evictedBos;
+    {
+        std::lock_guard<std::mutex> lock(userptrCacheMutex);
+        UserptrCacheKey key{rootDeviceIndex, address, size};
+        if (userptrCacheIndex.find(key) != userptrCacheIndex.end()) {
+            return false;
+        }
+        while (userptrCacheSize + size > userptrCacheMaxSize) {
+            auto &leastRecentlyUsed = userptrCache.back();
+            userptrCacheSize -= std::get<2>(leastRecentlyUsed.key);
+            evictedBos.push_back(leastRecentlyUsed.bo);
+            userptrCacheIndex.erase(leastRecentlyUsed.key);
+            userptrCache.pop_back();
+        }
+        userptrCache.push_front({key, bo});
+        userptrCacheIndex[key] = userptrCache.begin();
+        userptrCacheSize += size;
+    }
+    for (auto evictedBo : evictedBos) {
+        closeBufferObjectInBackground(evictedBo);
+    }
+    return true;
+}
+
+void DrmMemoryManager::releaseUserptrCache() {
+    std::lock_guard<std::mutex> lock(userptrCacheMutex);
+    for (auto &entry : userptrCache) {
+        closeBufferObjectInBackground(entry.bo);
+    }
+    userptrCache.clear();
+    userptrCacheIndex.clear();
+    userptrCacheSize = 0u;
+}
+
+void DrmMemoryManager::closeBufferObjectInBackground(BufferObject *bo) {
+    if (gemCloseWorker) {
+        gemCloseWorker->push(bo);
+    } else {
+        bo->wait(-1);
+        unreference(bo, true);
+    }
+}
+
 void DrmMemoryManager::emitPinningRequest(BufferObject *bo, const AllocationData &allocationData) const {
     if (forcePinEnabled && pinBBs.at(allocationData.rootDeviceIndex) != nullptr && allocationData.flags.forcePin && allocationData.size >= this->pinThreshold) {
         pinBBs.at(allocationData.rootDeviceIndex)->pin(&bo, 1, registeredEngines[defaultEngineIndex].osContext, 0, getDefaultDrmContextId());
@@ -616,7 +684,16 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation)
     }
 
     if (gfxAllocation->fragmentsStorage.fragmentCount) {
-        cleanGraphicsMemoryCreatedFromHostPtr(gfxAllocation);
+        auto rootDeviceIndex = gfxAllocation->getRootDeviceIndex();
+        auto &fragmentsStorage = gfxAllocation->fragmentsStorage;
+        hostPtrManager->releaseHandleStorage(rootDeviceIndex, fragmentsStorage);
+        for (auto &fragment : fragmentsStorage.fragmentStorageData) {
+            if (fragment.freeTheFragment && fragment.osHandleStorage && fragment.osHandleStorage->bo &&
+                storeUserptrInCache(fragment.osHandleStorage->bo, reinterpret_cast<uintptr_t>(fragment.cpuPtr), fragment.fragmentSize, rootDeviceIndex)) {
+                fragment.osHandleStorage->bo = nullptr;
+            }
+        }
+        cleanOsHandles(fragmentsStorage, rootDeviceIndex);
     } else {
         auto &bos = static_cast<DrmAllocation *>(gfxAllocation)->getBOs();
         for (auto bo : bos) {
@@ -662,9 +739,15 @@ MemoryManager::AllocationStatus DrmMemoryManager::populateOsHandles(OsHandleStor
             handleStorage.fragmentStorageData[i].osHandleStorage = new OsHandle();
             handleStorage.fragmentStorageData[i].residency = new ResidencyData(maxOsContextCount);
 
-            handleStorage.fragmentStorageData[i].osHandleStorage->bo = allocUserptr((uintptr_t)handleStorage.fragmentStorageData[i].cpuPtr,
-                                                                                    handleStorage.fragmentStorageData[i].fragmentSize,
-                                                                                    0, rootDeviceIndex);
+            // cached BOs are validated again below, host pages may have been unmapped since they were released
+            handleStorage.fragmentStorageData[i].osHandleStorage->bo = obtainUserptrFromCache(reinterpret_cast<uintptr_t>(handleStorage.fragmentStorageData[i].cpuPtr),
+                                                                                              handleStorage.fragmentStorageData[i].fragmentSize,
+                                                                                              rootDeviceIndex);
+            if (!handleStorage.fragmentStorageData[i].osHandleStorage->bo) {
+                handleStorage.fragmentStorageData[i].osHandleStorage->bo = allocUserptr((uintptr_t)handleStorage.fragmentStorageData[i].cpuPtr,
+                                                                                        handleStorage.fragmentStorageData[i].fragmentSize,
+                                                                                        0, rootDeviceIndex);
+            }
             if (!handleStorage.fragmentStorageData[i].osHandleStorage->bo) {
                 handleStorage.fragmentStorageData[i].freeTheFragment = true;
                 return AllocationStatus::Error;
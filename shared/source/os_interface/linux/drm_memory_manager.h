@@ -14,8 +14,10 @@
 #include "drm_gem_close_worker.h"
 
 #include <limits>
+#include <list>
 #include <map>
 #include <sys/mman.h>
+#include <tuple>
 
 namespace NEO {
 class BufferObject;
@@ -52,7 +54,7 @@ class DrmMemoryManager : public MemoryManager {
     }
 
     DrmGemCloseWorker *peekGemCloseWorker() const { return this->gemCloseWorker.get(); }
-    bool copyMemoryToAllocation(GraphicsAllocation *graphicsAllocation, const void *memoryToCopy, size_t sizeToCopy) override;
+    bool copyMemoryToAllocation(GraphicsAllocation *graphicsAllocation, size_t destinationOffset, const void *memoryToCopy, size_t sizeToCopy) override;
 
     int obtainFdFromHandle(int boHandle, uint32_t rootDeviceindex);
     AddressRange reserveGpuAddress(size_t size, uint32_t rootDeviceIndex) override;
@@ -64,6 +66,10 @@ class DrmMemoryManager : public MemoryManager {
     void eraseSharedBufferObject(BufferObject *bo);
     void pushSharedBufferObject(BufferObject *bo);
     BufferObject *allocUserptr(uintptr_t address, size_t size, uint64_t flags, uint32_t rootDeviceIndex);
+    BufferObject *obtainUserptrFromCache(uintptr_t address, size_t size, uint32_t rootDeviceIndex);
+    bool storeUserptrInCache(BufferObject *bo, uintptr_t address, size_t size, uint32_t rootDeviceIndex);
+    void releaseUserptrCache();
+    void closeBufferObjectInBackground(BufferObject *bo);
     bool setDomainCpu(GraphicsAllocation &graphicsAllocation, bool writeEnable);
     uint64_t acquireGpuRange(size_t &size, bool requireSpecificBitness, uint32_t rootDeviceIndex, bool requiresStandard64KBHeap);
     MOCKABLE_VIRTUAL void releaseGpuRange(void *address, size_t size, uint32_t rootDeviceIndex);
@@ -103,5 +109,17 @@ class DrmMemoryManager : public MemoryManager {
     decltype(&close) closeFunction = close;
     std::vector<BufferObject *> sharingBufferObjects;
     std::mutex mtx;
+
+    // userptr BOs of released host ptr fragments, most recently released first
+    using UserptrCacheKey = std::tuple<uint32_t, uintptr_t, size_t>;
+    struct UserptrCacheEntry {
+        UserptrCacheKey key;
+        BufferObject *bo;
+    };
+    std::list<UserptrCacheEntry> userptrCache;
+    std::map<UserptrCacheKey, std::list<UserptrCacheEntry>::iterator> userptrCacheIndex;
+    size_t userptrCacheSize = 0u;
+    size_t userptrCacheMaxSize = 0u;
+    std::mutex userptrCacheMutex;
 };
 } // namespace NEO
@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/program/kernel_isa_packing.h"
+
+#include "shared/source/helpers/aligned_memory.h"
+
+namespace NEO {
+
+namespace KernelIsaPacking {
+std::vector<size_t> packKernelsIsa(const std::vector<size_t> &isaSizes, std::vector<IsaPlacement> &outPlacements) {
+    std::vector<size_t> allocationSizes;
+    outPlacements.clear();
+    outPlacements.reserve(isaSizes.size());
+
+    size_t currentOffset = 0;
+    for (auto isaSize : isaSizes) {
+        auto offset = alignUp(currentOffset, isaAlignment);
+        bool fitsInCurrentAllocation = offset + isaSize + prefetchPadding <= maxPackedAllocationSize;
+        if (allocationSizes.empty() || (false == fitsInCurrentAllocation && offset != 0)) {
+            allocationSizes.push_back(0);
+            offset = 0;
+        }
+        outPlacements.push_back({allocationSizes.size() - 1, offset});
+        currentOffset = offset + isaSize;
+        allocationSizes.back() = currentOffset + prefetchPadding;
+    }
+    return allocationSizes;
+}
+} // namespace KernelIsaPacking
+
+} // namespace NEO
@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace NEO {
+
+namespace KernelIsaPacking {
+// Kernel start pointer has to be cache line aligned
+constexpr size_t isaAlignment = MemoryConstants::cacheLineSize;
+// Instruction fetch may read ahead of the last kernel placed in an allocation
+constexpr size_t prefetchPadding = 512;
+constexpr size_t maxPackedAllocationSize = 2 * MemoryConstants::megaByte;
+
+struct IsaPlacement {
+    size_t allocationId = 0;
+    size_t offset = 0;
+};
+
+// Places kernels one after another in as few allocations as possible.
+// Returns sizes of allocations to create, placements are filled per kernel.
+std::vector<size_t> packKernelsIsa(const std::vector<size_t> &isaSizes, std::vector<IsaPlacement> &outPlacements);
+} // namespace KernelIsaPacking
+
+} // namespace NEO
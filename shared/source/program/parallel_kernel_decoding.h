@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/utilities/parallel_for.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace NEO {
+
+namespace ParallelKernelDecoding {
+// Below this many kernels per thread, starting threads costs more than it saves
+constexpr size_t minKernelsPerThread = 16;
+constexpr uint32_t defaultMaxThreads = 8;
+
+inline uint32_t getThreadsCount(size_t kernelsCount) {
+    if (DebugManager.flags.EnableParallelKernelDecoding.get() != 1) {
+        return 1;
+    }
+    uint32_t maxThreads = std::min(std::max(std::thread::hardware_concurrency() / 2, 1u), defaultMaxThreads);
+    if (DebugManager.flags.ParallelKernelDecodingThreads.get() != -1) {
+        maxThreads = static_cast<uint32_t>(std::max(DebugManager.flags.ParallelKernelDecodingThreads.get(), 1));
+    }
+    auto threadsForKernels = static_cast<uint32_t>(std::max(kernelsCount / minKernelsPerThread, static_cast<size_t>(1)));
+    return std::min(maxThreads, threadsForKernels);
+}
+} // namespace ParallelKernelDecoding
+
+} // namespace NEO
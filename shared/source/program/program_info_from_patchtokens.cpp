@@ -10,6 +10,7 @@
 #include "shared/source/compiler_interface/linker.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device_binary_format/patchtokens_decoder.h"
+#include "shared/source/program/parallel_kernel_decoding.h"
 #include "shared/source/program/program_info.h"
 
 #include "opencl/source/program/kernel_info.h"
@@ -26,12 +27,8 @@ bool requiresLocalMemoryWindowVA(const PatchTokenBinary::ProgramFromPatchtokens
     return false;
 }
 
-void populateSingleKernelInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &decodedProgram, uint32_t kernelNum) {
-    auto kernelInfo = std::make_unique<KernelInfo>();
+void populateLinkerInputForKernel(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &decodedProgram, uint32_t kernelNum) {
     const PatchTokenBinary::KernelFromPatchtokens &decodedKernel = decodedProgram.kernels[kernelNum];
-
-    NEO::populateKernelInfo(*kernelInfo, decodedKernel, decodedProgram.header->GPUPointerSizeInBytes);
-
     if (decodedKernel.tokens.programSymbolTable) {
         dst.prepareLinkerInputStorage();
         dst.linkerInput->decodeExportedFunctionsSymbolTable(decodedKernel.tokens.programSymbolTable + 1, decodedKernel.tokens.programSymbolTable->NumEntries, kernelNum);
@@ -41,13 +38,33 @@ void populateSingleKernelInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramF
         dst.prepareLinkerInputStorage();
         dst.linkerInput->decodeRelocationTable(decodedKernel.tokens.programRelocationTable + 1, decodedKernel.tokens.programRelocationTable->NumEntries, kernelNum);
     }
+}
 
+void populateSingleKernelInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &decodedProgram, uint32_t kernelNum) {
+    auto kernelInfo = std::make_unique<KernelInfo>();
+    NEO::populateKernelInfo(*kernelInfo, decodedProgram.kernels[kernelNum], decodedProgram.header->GPUPointerSizeInBytes);
+    populateLinkerInputForKernel(dst, decodedProgram, kernelNum);
     dst.kernelInfos.push_back(kernelInfo.release());
 }
 
 void populateProgramInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &src) {
-    for (uint32_t i = 0; i < src.kernels.size(); ++i) {
-        populateSingleKernelInfo(dst, src, i);
+    auto threadsCount = ParallelKernelDecoding::getThreadsCount(src.kernels.size());
+    if (threadsCount > 1) {
+        // Kernel infos are independent, linker input is shared so it is filled afterwards in kernels order
+        std::vector<std::unique_ptr<KernelInfo>> kernelInfos(src.kernels.size());
+        parallelFor(src.kernels.size(), threadsCount, [&](size_t kernelNum) {
+            kernelInfos[kernelNum] = std::make_unique<KernelInfo>();
+            NEO::populateKernelInfo(*kernelInfos[kernelNum], src.kernels[kernelNum], src.header->GPUPointerSizeInBytes);
+        });
+        dst.kernelInfos.reserve(dst.kernelInfos.size() + kernelInfos.size());
+        for (uint32_t i = 0; i < src.kernels.size(); ++i) {
+            populateLinkerInputForKernel(dst, src, i);
+            dst.kernelInfos.push_back(kernelInfos[i].release());
+        }
+    } else {
+        for (uint32_t i = 0; i < src.kernels.size(); ++i) {
+            populateSingleKernelInfo(dst, src, i);
+        }
     }
 
     if (src.programScopeTokens.allocateConstantMemorySurface.empty() == false) {
@@ -39,7 +39,7 @@ GraphicsAllocation *allocateGlobalsSurface(NEO::SVMAllocsManager *const svmAlloc
         UNRECOVERABLE_IF(svmAlloc == nullptr);
         auto gpuAlloc = svmAlloc->gpuAllocations.getGraphicsAllocation(device.getRootDeviceIndex());
         UNRECOVERABLE_IF(gpuAlloc == nullptr);
-        device.getMemoryManager()->copyMemoryToAllocation(gpuAlloc, initData, static_cast<uint32_t>(size));
+        device.getMemoryManager()->copyMemoryToAllocation(gpuAlloc, 0u, initData, static_cast<uint32_t>(size));
         return gpuAlloc;
     } else {
         auto allocationType = constant ? GraphicsAllocation::AllocationType::CONSTANT_SURFACE : GraphicsAllocation::AllocationType::GLOBAL_SURFACE;
@@ -223,4 +223,16 @@ constexpr bool equalsCaseInsesitive(const ConstStringRef &lhs, const ConstString
     return true;
 }
 
+struct ConstStringRefHash {
+    size_t operator()(const ConstStringRef &str) const noexcept {
+        // FNV-1a
+        uint64_t hash = 14695981039346656037ULL;
+        for (auto c : str) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 1099511628211ULL;
+        }
+        return static_cast<size_t>(hash);
+    }
+};
+
 } // namespace NEO
\ No newline at end of file
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/cpu_copy_engine.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <cstring>
+#include <emmintrin.h>
+#include <thread>
+
+namespace NEO {
+
+CpuCopyEngine::CpuCopyEngine(uint32_t numWorkers, size_t parallelCopyMinSize, size_t nonTemporalCopyMinSize)
+    : parallelCopyMinSize(parallelCopyMinSize), nonTemporalCopyMinSize(nonTemporalCopyMinSize) {
+    for (uint32_t i = 0; i < numWorkers; i++) {
+        workers.push_back(Thread::create(workerLoop, reinterpret_cast<void *>(this)));
+    }
+}
+
+CpuCopyEngine::~CpuCopyEngine() {
+    {
+        std::lock_guard<std::mutex> lock(jobMutex);
+        stopWorkers = true;
+    }
+    jobAvailable.notify_all();
+    for (auto &worker : workers) {
+        worker->join();
+    }
+}
+
+std::unique_ptr<CpuCopyEngine> CpuCopyEngine::create() {
+    if (DebugManager.flags.EnableParallelCpuCopy.get() != 1) {
+        return nullptr;
+    }
+
+    uint32_t numWorkers = std::min(std::max(std::thread::hardware_concurrency() / 2, 1u) - 1, 15u);
+    if (DebugManager.flags.ParallelCpuCopyThreads.get() != -1) {
+        numWorkers = static_cast<uint32_t>(std::max(DebugManager.flags.ParallelCpuCopyThreads.get() - 1, 0));
+    }
+    size_t parallelCopyMinSize = defaultParallelCopyMinSize;
+    if (DebugManager.flags.ParallelCpuCopyMinSizeInKb.get() != -1) {
+        parallelCopyMinSize = DebugManager.flags.ParallelCpuCopyMinSizeInKb.get() * MemoryConstants::kiloByte;
+    }
+    size_t nonTemporalCopyMinSize = defaultNonTemporalCopyMinSize;
+    if (DebugManager.flags.NonTemporalCpuCopyMinSizeInKb.get() != -1) {
+        nonTemporalCopyMinSize = DebugManager.flags.NonTemporalCpuCopyMinSizeInKb.get() * MemoryConstants::kiloByte;
+    }
+    return std::make_unique<CpuCopyEngine>(numWorkers, parallelCopyMinSize, nonTemporalCopyMinSize);
+}
+
+size_t CpuCopyEngine::getChunkSize(size_t size) const {
+    // A few chunks per thread balance the load when some threads start late
+    constexpr size_t chunksPerThread = 4;
+    auto threadsCount = workers.size() + 1;
+    auto chunkSize = alignUp((size + threadsCount * chunksPerThread - 1) / (threadsCount * chunksPerThread), chunkAlignment);
+    return std::max(chunkSize, chunkAlignment);
+}
+
+void CpuCopyEngine::copy(void *dst, const void *src, size_t size) {
+    if (size == 0) {
+        return;
+    }
+    bool nonTemporal = size >= nonTemporalCopyMinSize;
+
+    if (workers.empty() || size < parallelCopyMinSize) {
+        if (nonTemporal) {
+            copyNonTemporal(dst, src, size);
+        } else {
+            memcpy(dst, src, size);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> submissionLock(submissionMutex);
+
+    // Chunk boundaries are page aligned in destination, so threads never write to the same page
+    auto job = std::make_shared<CopyJob>();
+    auto dstBase = alignDown(reinterpret_cast<uintptr_t>(dst), chunkAlignment);
+    job->dst = static_cast<char *>(dst);
+    job->src = static_cast<const char *>(src);
+    job->size = size;
+    job->chunkSize = getChunkSize(size);
+    job->headOffset = reinterpret_cast<uintptr_t>(dst) - dstBase;
+    job->chunksCount = (job->headOffset + size + job->chunkSize - 1) / job->chunkSize;
+    job->nonTemporal = nonTemporal;
+
+    {
+        std::lock_guard<std::mutex> lock(jobMutex);
+        currentJob = job;
+        jobGeneration++;
+    }
+    jobAvailable.notify_all();
+
+    processChunks(*job);
+
+    {
+        std::unique_lock<std::mutex> lock(job->completionMutex);
+        job->completion.wait(lock, [&job]() { return job->completedChunks == job->chunksCount; });
+    }
+
+    std::lock_guard<std::mutex> lock(jobMutex);
+    currentJob.reset();
+}
+
+void CpuCopyEngine::processChunks(CopyJob &job) {
+    while (true) {
+        auto chunk = job.nextChunk++;
+        if (chunk >= job.chunksCount) {
+            return;
+        }
+        size_t chunkStart = (chunk == 0) ? 0 : chunk * job.chunkSize - job.headOffset;
+        size_t chunkEnd = std::min((chunk + 1) * job.chunkSize - job.headOffset, job.size);
+        if (job.nonTemporal) {
+            copyNonTemporal(job.dst + chunkStart, job.src + chunkStart, chunkEnd - chunkStart);
+        } else {
+            memcpy(job.dst + chunkStart, job.src + chunkStart, chunkEnd - chunkStart);
+        }
+
+        if (++job.completedChunks == job.chunksCount) {
+            std::lock_guard<std::mutex> lock(job.completionMutex);
+            job.completion.notify_all();
+        }
+    }
+}
+
+void *CpuCopyEngine::workerLoop(void *arg) {
+    auto self = reinterpret_cast<CpuCopyEngine *>(arg);
+    uint64_t lastGeneration = 0;
+    std::unique_lock<std::mutex> lock(self->jobMutex);
+    while (true) {
+        self->jobAvailable.wait(lock, [&]() { return self->stopWorkers || self->jobGeneration != lastGeneration; });
+        if (self->stopWorkers) {
+            break;
+        }
+        lastGeneration = self->jobGeneration;
+        auto job = self->currentJob;
+        lock.unlock();
+        if (job) {
+            processChunks(*job);
+        }
+        lock.lock();
+    }
+    return nullptr;
+}
+
+void CpuCopyEngine::copyNonTemporal(void *dst, const void *src, size_t size) {
+    constexpr size_t vectorSize = sizeof(__m128i);
+    auto dstBytes = static_cast<char *>(dst);
+    auto srcBytes = static_cast<const char *>(src);
+
+    // Streaming stores require aligned destination
+    auto headSize = std::min(ptrDiff(alignUp(dstBytes, vectorSize), dstBytes), size);
+    memcpy(dstBytes, srcBytes, headSize);
+
+    size_t offset = headSize;
+    for (; offset + vectorSize <= size; offset += vectorSize) {
+        auto data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes + offset));
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes + offset), data);
+    }
+    memcpy(dstBytes + offset, srcBytes + offset, size - offset);
+
+    // Make streaming stores globally visible before transfer is reported as completed
+    _mm_sfence();
+}
+
+} // namespace NEO
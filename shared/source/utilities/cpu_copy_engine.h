@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Copies host memory on the CPU, splitting large copies into page aligned chunks
+// processed by a persistent pool of worker threads together with the calling thread.
+class CpuCopyEngine {
+  public:
+    static constexpr size_t defaultParallelCopyMinSize = MemoryConstants::megaByte;
+    static constexpr size_t defaultNonTemporalCopyMinSize = 8 * MemoryConstants::megaByte;
+    static constexpr size_t chunkAlignment = MemoryConstants::pageSize;
+
+    CpuCopyEngine(uint32_t numWorkers, size_t parallelCopyMinSize, size_t nonTemporalCopyMinSize);
+    virtual ~CpuCopyEngine();
+
+    CpuCopyEngine(const CpuCopyEngine &) = delete;
+    CpuCopyEngine &operator=(const CpuCopyEngine &) = delete;
+
+    static std::unique_ptr<CpuCopyEngine> create();
+
+    void copy(void *dst, const void *src, size_t size);
+
+    uint32_t getNumWorkers() const { return static_cast<uint32_t>(workers.size()); }
+    size_t getChunkSize(size_t size) const;
+
+    static void copyNonTemporal(void *dst, const void *src, size_t size);
+
+  protected:
+    struct CopyJob {
+        char *dst = nullptr;
+        const char *src = nullptr;
+        size_t size = 0;
+        size_t chunkSize = 0;
+        size_t headOffset = 0;
+        size_t chunksCount = 0;
+        bool nonTemporal = false;
+        std::atomic<size_t> nextChunk{0};
+        std::atomic<size_t> completedChunks{0};
+        std::mutex completionMutex;
+        std::condition_variable completion;
+    };
+
+    static void *workerLoop(void *arg);
+    static void processChunks(CopyJob &job);
+
+    size_t parallelCopyMinSize;
+    size_t nonTemporalCopyMinSize;
+
+    std::vector<std::unique_ptr<Thread>> workers;
+    std::shared_ptr<CopyJob> currentJob;
+    uint64_t jobGeneration = 0;
+    bool stopWorkers = false;
+    std::mutex jobMutex;
+    std::condition_variable jobAvailable;
+    std::mutex submissionMutex;
+};
+} // namespace NEO
@@ -52,6 +52,7 @@ struct CpuInfo {
     static const uint64_t featureClflush = 0x2000000000ULL;
     static const uint64_t featureTsc = 0x4000000000ULL;
     static const uint64_t featureRdtscp = 0x8000000000ULL;
+    static const uint64_t featureAvX512Bw = 0x10000000000ULL;
 
     CpuInfo() : features(featureNone) {
     }
@@ -173,6 +174,14 @@ struct CpuInfo {
             {
                 features |= cpuInfo[1] & BIT(11) ? featureRtm : featureNone;
             }
+
+            {
+                features |= cpuInfo[1] & BIT(16) ? featureAvX512F : featureNone;
+            }
+
+            {
+                features |= cpuInfo[1] & BIT(30) ? featureAvX512Bw : featureNone;
+            }
         }
 
         cpuid(cpuInfo, 0x80000000);
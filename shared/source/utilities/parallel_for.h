@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+// Runs task(0) .. task(count - 1) on the calling thread and at most threadsCount - 1 helper threads.
+// Indices are claimed from a shared counter, so tasks should write results to per-index slots
+// to keep them in deterministic order. Returns when all tasks completed.
+template <typename TaskT>
+void parallelFor(size_t count, uint32_t threadsCount, TaskT &&task) {
+    auto helpersCount = std::min(static_cast<size_t>(std::max(threadsCount, 1u) - 1), count > 0 ? count - 1 : 0);
+    if (helpersCount == 0) {
+        for (size_t i = 0; i < count; i++) {
+            task(i);
+        }
+        return;
+    }
+
+    std::atomic<size_t> nextTask{0};
+    auto worker = [&]() {
+        for (auto i = nextTask++; i < count; i = nextTask++) {
+            task(i);
+        }
+    };
+
+    std::vector<std::thread> helpers;
+    helpers.reserve(helpersCount);
+    for (size_t i = 0; i < helpersCount; i++) {
+        helpers.emplace_back(worker);
+    }
+    worker();
+    for (auto &helper : helpers) {
+        helper.join();
+    }
+}
+
+} // namespace NEO
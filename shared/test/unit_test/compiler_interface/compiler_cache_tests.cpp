@@ -22,6 +22,7 @@
 #include <array>
 #include <list>
 #include <memory>
+#include <vector>
 
 using namespace NEO;
 
@@ -36,12 +37,14 @@ class CompilerCacheMock : public CompilerCache {
     }
 
     std::unique_ptr<char[]> loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) override {
+        loadedHashes.push_back(kernelFileHash);
         return loadResult ? std::unique_ptr<char[]>{new char[1]} : nullptr;
     }
 
     bool cacheResult = false;
     uint32_t cacheInvoked = 0u;
     bool loadResult = false;
+    std::vector<std::string> loadedHashes;
 };
 
 TEST(HashGeneration, givenMisalignedBufferWhenPassedToUpdateFunctionThenProperPtrDataIsUsed) {
@@ -219,6 +222,18 @@ TEST(CompilerCacheHashTests, GivenCompilingOptionsWhenGettingCacheThenCorrectCac
     EXPECT_STREQ(hash.c_str(), hash2.c_str());
 }
 
+TEST(CompilerCacheHashTests, GivenAdditionalInputWhenGettingCacheThenItChangesHashOnlyWhenNotEmpty) {
+    HardwareInfo hwInfo;
+    const char src[] = "__kernel k() {}";
+    const char options[] = "-cl-opt-disable";
+    const char internalOptions[] = "";
+    const char additionalInput[] = "link";
+
+    auto hash = CompilerCache::getCachedFileName(hwInfo, src, options, internalOptions);
+    EXPECT_EQ(hash, CompilerCache::getCachedFileName(hwInfo, src, options, internalOptions, ArrayRef<const char>()));
+    EXPECT_NE(hash, CompilerCache::getCachedFileName(hwInfo, src, options, internalOptions, additionalInput));
+}
+
 TEST(CompilerCacheTests, GivenEmptyBinaryWhenCachingThenBinaryIsNotCached) {
     CompilerCache cache(CompilerCacheConfig{});
     bool ret = cache.cacheBinary("some_hash", nullptr, 12u);
@@ -368,3 +383,129 @@ TEST(CompilerInterfaceCachedTests, givenKernelWithIncludesAndBinaryInCacheWhenCo
 
     gEnvironment->fclPopDebugVars();
 }
+
+TEST(CompilerInterfaceCachedTests, givenDifferentSpecConstantValuesWhenBuildingWithCachingThenDifferentCacheEntriesAreUsed) {
+    TranslationInput inputArgs{IGC::CodeType::spirV, IGC::CodeType::oclGenBin};
+
+    auto src = "spirv";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+    inputArgs.allowCaching = true;
+
+    auto cache = std::make_unique<CompilerCacheMock>();
+    cache->loadResult = true;
+    auto cacheRef = cache.get();
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::move(cache), true));
+    MockDevice device;
+
+    TranslationOutput translationOutput;
+    inputArgs.specializedValues[1] = 5u;
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, compilerInterface->build(device, inputArgs, translationOutput));
+
+    TranslationOutput otherTranslationOutput;
+    inputArgs.specializedValues[1] = 7u;
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, compilerInterface->build(device, inputArgs, otherTranslationOutput));
+
+    ASSERT_EQ(2u, cacheRef->loadedHashes.size());
+    EXPECT_NE(cacheRef->loadedHashes[0], cacheRef->loadedHashes[1]);
+}
+
+TEST(CompilerInterfaceCachedTests, givenKernelWithoutIncludesAndIrInCacheWhenCompileIsRequestedThenFCLIsNotCalled) {
+    TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::spirV};
+
+    auto src = "__kernel k() {}";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+    inputArgs.allowCaching = true;
+
+    MockCompilerDebugVars fclDebugVars;
+    fclDebugVars.fileName = gEnvironment->fclGetMockFile();
+    fclDebugVars.forceBuildFailure = true;
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+
+    auto cache = std::make_unique<CompilerCacheMock>();
+    cache->loadResult = true;
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::move(cache), true));
+    MockDevice device;
+
+    TranslationOutput translationOutput;
+    auto err = compilerInterface->compile(device, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+    EXPECT_NE(nullptr, translationOutput.intermediateRepresentation.mem);
+    EXPECT_EQ(IGC::CodeType::spirV, translationOutput.intermediateCodeType);
+
+    gEnvironment->fclPopDebugVars();
+}
+
+TEST(CompilerInterfaceCachedTests, givenKernelWithIncludesAndIrInCacheWhenCompileIsRequestedThenFCLIsCalled) {
+    TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::spirV};
+
+    auto src = "#include \"file.h\"\n__kernel k() {}";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+    inputArgs.allowCaching = true;
+
+    MockCompilerDebugVars fclDebugVars;
+    fclDebugVars.fileName = gEnvironment->fclGetMockFile();
+    fclDebugVars.forceBuildFailure = true;
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+
+    auto cache = std::make_unique<CompilerCacheMock>();
+    cache->loadResult = true;
+    auto cacheRef = cache.get();
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::move(cache), true));
+    MockDevice device;
+
+    TranslationOutput translationOutput;
+    auto err = compilerInterface->compile(device, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::CompilationFailure, err);
+    EXPECT_TRUE(cacheRef->loadedHashes.empty());
+
+    gEnvironment->fclPopDebugVars();
+}
+
+TEST(CompilerInterfaceCachedTests, givenBinaryInCacheWhenLinkIsRequestedThenIGCIsNotCalled) {
+    TranslationInput inputArgs{IGC::CodeType::elf, IGC::CodeType::oclGenBin};
+
+    auto src = "elf";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+    inputArgs.allowCaching = true;
+
+    MockCompilerDebugVars igcDebugVars;
+    igcDebugVars.fileName = gEnvironment->igcGetMockFile();
+    igcDebugVars.forceBuildFailure = true;
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    auto cache = std::make_unique<CompilerCacheMock>();
+    cache->loadResult = true;
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::move(cache), true));
+    MockDevice device;
+
+    TranslationOutput translationOutput;
+    auto err = compilerInterface->link(device, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+    EXPECT_NE(nullptr, translationOutput.deviceBinary.mem);
+
+    gEnvironment->igcPopDebugVars();
+}
+
+TEST(CompilerInterfaceCachedTests, givenNoBinaryInCacheWhenLinkSucceedsThenBinaryIsCached) {
+    TranslationInput inputArgs{IGC::CodeType::elf, IGC::CodeType::oclGenBin};
+
+    auto src = "elf";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+    inputArgs.allowCaching = true;
+
+    MockCompilerDebugVars igcDebugVars;
+    igcDebugVars.fileName = gEnvironment->igcGetMockFile();
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    auto cache = std::make_unique<CompilerCacheMock>();
+    auto cacheRef = cache.get();
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::move(cache), true));
+    MockDevice device;
+
+    TranslationOutput translationOutput;
+    auto err = compilerInterface->link(device, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+    EXPECT_EQ(1u, cacheRef->cacheInvoked);
+
+    gEnvironment->igcPopDebugVars();
+}
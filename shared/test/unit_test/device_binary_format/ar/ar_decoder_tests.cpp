@@ -425,3 +425,44 @@ TEST(ArDecoderDecodeAr, GivenFilesWithLongFilenamesWhenLongNameIsOutOfBoundsThen
     EXPECT_FALSE(decodeErrors.empty());
     EXPECT_STREQ("Corrupt AR archive - long file name entry has broken identifier : '/100            '", decodeErrors.c_str());
 }
+
+TEST(ArDecoderDecodeArFileEntries, WhenVisitorReturnsFalseThenWalkingStopsAndRemainingEntriesAreNotValidated) {
+    const uint8_t data0[8] = "1234567";
+    std::vector<uint8_t> arStorage;
+    arStorage.insert(arStorage.end(), reinterpret_cast<const uint8_t *>(arMagic.begin()), reinterpret_cast<const uint8_t *>(arMagic.end()));
+    ArFileEntryHeader fileEntry0;
+    fileEntry0.identifier[0] = 'a';
+    fileEntry0.identifier[1] = '/';
+    fileEntry0.fileSizeInBytes[0] = '8';
+    arStorage.insert(arStorage.end(), reinterpret_cast<const uint8_t *>(&fileEntry0), reinterpret_cast<const uint8_t *>(&fileEntry0 + 1));
+    arStorage.insert(arStorage.end(), data0, data0 + sizeof(data0));
+
+    ArFileEntryHeader fileEntry1;
+    fileEntry1.identifier[0] = 'b';
+    fileEntry1.identifier[1] = '/';
+    fileEntry1.fileSizeInBytes[0] = '8';
+    arStorage.insert(arStorage.end(), reinterpret_cast<const uint8_t *>(&fileEntry1), reinterpret_cast<const uint8_t *>(&fileEntry1 + 1));
+
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    ArFileEntryHeaderAndData longFileNamesEntry;
+    std::vector<NEO::ConstStringRef> visitedFiles;
+    bool success = decodeArFileEntries(arStorage, longFileNamesEntry, decodeErrors, decodeWarnings, [&](const ArFileEntryHeaderAndData &fileEntry) {
+        visitedFiles.push_back(fileEntry.fileName);
+        return false;
+    });
+    EXPECT_TRUE(success);
+    EXPECT_TRUE(decodeErrors.empty()) << decodeErrors;
+    EXPECT_TRUE(decodeWarnings.empty()) << decodeWarnings;
+    ASSERT_EQ(1U, visitedFiles.size());
+    EXPECT_EQ("a", visitedFiles[0]);
+
+    visitedFiles.clear();
+    success = decodeArFileEntries(arStorage, longFileNamesEntry, decodeErrors, decodeWarnings, [&](const ArFileEntryHeaderAndData &fileEntry) {
+        visitedFiles.push_back(fileEntry.fileName);
+        return true;
+    });
+    EXPECT_FALSE(success);
+    EXPECT_STREQ("Corrupt AR archive - out of bounds data of file entry with idenfitier 'b/              '", decodeErrors.c_str());
+    ASSERT_EQ(1U, visitedFiles.size());
+}
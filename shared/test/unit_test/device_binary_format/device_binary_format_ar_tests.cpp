@@ -182,3 +182,37 @@ TEST(UnpackSingleDeviceBinaryAr, WhenCouldFindBinaryWithRightPointerSizeThenUnpa
     EXPECT_TRUE(unpackWarnings.empty()) << unpackWarnings;
     EXPECT_STREQ("Couldn't find matching binary in AR archive", unpackErrors.c_str());
 }
+
+TEST(UnpackSingleDeviceBinaryAr, WhenPerfectMatchIsFoundThenRemainingFileEntriesAreNotDecoded) {
+    PatchTokensTestData::ValidEmptyProgram programTokens;
+    NEO::Ar::ArEncoder encoder;
+    std::string requiredProduct = NEO::hardwarePrefix[productFamily];
+    std::string requiredStepping = std::to_string(programTokens.header->SteppingId);
+    std::string requiredPointerSize = (programTokens.header->GPUPointerSizeInBytes == 4) ? "32" : "64";
+    ASSERT_TRUE(encoder.appendFileEntry(requiredPointerSize + "." + requiredProduct + "." + requiredStepping, programTokens.storage));
+
+    NEO::TargetDevice target;
+    target.coreFamily = static_cast<GFXCORE_FAMILY>(programTokens.header->Device);
+    target.stepping = programTokens.header->SteppingId;
+    target.maxPointerSizeInBytes = programTokens.header->GPUPointerSizeInBytes;
+
+    auto arData = encoder.encode();
+    NEO::Ar::ArFileEntryHeader corruptFileEntry;
+    corruptFileEntry.identifier[0] = 'a';
+    corruptFileEntry.identifier[1] = '/';
+    corruptFileEntry.fileSizeInBytes[0] = '8';
+    arData.insert(arData.end(), reinterpret_cast<const uint8_t *>(&corruptFileEntry), reinterpret_cast<const uint8_t *>(&corruptFileEntry + 1));
+
+    std::string unpackErrors;
+    std::string unpackWarnings;
+    auto unpacked = NEO::unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::Archive>(arData, requiredProduct, target, unpackErrors, unpackWarnings);
+    EXPECT_TRUE(unpackErrors.empty()) << unpackErrors;
+    EXPECT_TRUE(unpackWarnings.empty()) << unpackWarnings;
+    EXPECT_EQ(NEO::DeviceBinaryFormat::Patchtokens, unpacked.format);
+    EXPECT_EQ(arData.data() + NEO::Ar::arMagic.size() + sizeof(NEO::Ar::ArFileEntryHeader), unpacked.deviceBinary.begin());
+
+    unpackErrors.clear();
+    auto decodedAr = NEO::Ar::decodeAr(arData, unpackErrors, unpackWarnings);
+    EXPECT_EQ(nullptr, decodedAr.magic);
+    EXPECT_FALSE(unpackErrors.empty());
+}
@@ -1879,6 +1879,117 @@ TEST(YamlParserParse, GivenValidYamlThenParsesItCorrectly) {
     EXPECT_TRUE(parserWarnings.empty());
 }
 
+TEST(YamlTokenizeAndBuildTree, GivenValidYamlThenBuildsSameTreeAsSeparateTokenizeAndBuildTree) {
+    ConstStringRef yaml =
+        R"===(
+---
+kernels:
+  - name: k
+    execution_env:
+      grf_count: 128
+      simd_size: 32
+    payload_arguments:
+      - arg_type: global_id_offset
+        offset: 0
+        size: 12
+...
+)===";
+
+    NEO::Yaml::LinesCache lines;
+    NEO::Yaml::TokensCache tokens;
+    NEO::Yaml::NodesCache nodes;
+    std::string errors;
+    std::string warnings;
+    bool success = NEO::Yaml::tokenize(yaml, lines, tokens, errors, warnings);
+    success = success && NEO::Yaml::buildTree(lines, tokens, nodes, errors, warnings);
+    EXPECT_TRUE(success);
+
+    NEO::Yaml::TokensCache singlePassTokens;
+    NEO::Yaml::NodesCache singlePassNodes;
+    std::string singlePassErrors;
+    std::string singlePassWarnings;
+    success = NEO::Yaml::tokenizeAndBuildTree(yaml, singlePassTokens, singlePassNodes, singlePassErrors, singlePassWarnings);
+    EXPECT_TRUE(success);
+    EXPECT_STREQ(errors.c_str(), singlePassErrors.c_str());
+    EXPECT_STREQ(warnings.c_str(), singlePassWarnings.c_str());
+
+    ASSERT_EQ(tokens.size(), singlePassTokens.size());
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        EXPECT_EQ(tokens[i].pos, singlePassTokens[i].pos);
+        EXPECT_EQ(tokens[i].len, singlePassTokens[i].len);
+    }
+
+    ASSERT_EQ(nodes.size(), singlePassNodes.size());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        EXPECT_EQ(nodes[i].key, singlePassNodes[i].key);
+        EXPECT_EQ(nodes[i].value, singlePassNodes[i].value);
+        EXPECT_EQ(nodes[i].indent, singlePassNodes[i].indent);
+        EXPECT_EQ(nodes[i].id, singlePassNodes[i].id);
+        EXPECT_EQ(nodes[i].parentId, singlePassNodes[i].parentId);
+        EXPECT_EQ(nodes[i].firstChildId, singlePassNodes[i].firstChildId);
+        EXPECT_EQ(nodes[i].lastChildId, singlePassNodes[i].lastChildId);
+        EXPECT_EQ(nodes[i].nextSiblingId, singlePassNodes[i].nextSiblingId);
+        EXPECT_EQ(nodes[i].numChildren, singlePassNodes[i].numChildren);
+    }
+}
+
+TEST(YamlReserveForText, GivenLargeTextThenReservesCachesUpFront) {
+    std::string yaml;
+    for (int i = 0; i < 1000; ++i) {
+        yaml += "key" + std::to_string(i) + ": " + std::to_string(i) + "\n";
+    }
+
+    NEO::Yaml::TokensCache tokens;
+    NEO::Yaml::NodesCache nodes;
+    NEO::Yaml::reserveForText(yaml, tokens, nodes);
+    EXPECT_LE(1001U * NEO::Yaml::estimatedTokensPerLine, tokens.capacity());
+    EXPECT_LE(1002U, nodes.capacity());
+    EXPECT_TRUE(tokens.empty());
+    EXPECT_TRUE(nodes.empty());
+}
+
+TEST(YamlParserParse, GivenYamlWithMoreNodesThanFitIn16BitsThenParsesItCorrectly) {
+    constexpr uint32_t numKernels = 8000U;
+    std::string yaml = "kernels:\n";
+    for (uint32_t i = 0; i < numKernels; ++i) {
+        yaml += "  - name: kernel_" + std::to_string(i) + "\n";
+        yaml += "    execution_env:\n";
+        yaml += "      grf_count: 128\n";
+        yaml += "      simd_size: 8\n";
+        yaml += "    payload_arguments:\n";
+        yaml += "      - arg_type: arg_bypointer\n";
+        yaml += "        offset: " + std::to_string(i) + "\n";
+    }
+
+    std::string parserErrors;
+    std::string parserWarnings;
+    NEO::Yaml::YamlParser parser;
+    bool success = parser.parse(yaml, parserErrors, parserWarnings);
+    ASSERT_TRUE(success) << parserErrors;
+    EXPECT_TRUE(parserWarnings.empty()) << parserWarnings;
+
+    auto kernelsNd = parser.getChild(*parser.getRoot(), "kernels");
+    ASSERT_NE(nullptr, kernelsNd);
+    EXPECT_EQ(numKernels, kernelsNd->numChildren);
+
+    uint32_t kernelId = 0U;
+    for (const auto &kernelNd : parser.createChildrenRange(*kernelsNd)) {
+        auto nameNd = parser.getChild(kernelNd, "name");
+        ASSERT_NE(nullptr, nameNd);
+        EXPECT_STREQ(("kernel_" + std::to_string(kernelId)).c_str(), parser.readValue(*nameNd).str().c_str());
+
+        auto payloadArgsNd = parser.getChild(kernelNd, "payload_arguments");
+        ASSERT_NE(nullptr, payloadArgsNd);
+        auto offsetNd = parser.getChild(*parser.createChildrenRange(*payloadArgsNd).begin(), "offset");
+        ASSERT_NE(nullptr, offsetNd);
+        uint32_t offset = 0U;
+        EXPECT_TRUE(parser.readValueChecked(*offsetNd, offset));
+        EXPECT_EQ(kernelId, offset);
+        ++kernelId;
+    }
+    EXPECT_EQ(numKernels, kernelId);
+}
+
 TEST(YamlParser, WhenGetRootIsCalledThenReturnsFirstNode) {
     ConstStringRef yaml =
         R"===(
@@ -9,6 +9,7 @@
 #include "shared/source/device_binary_format/elf/zebin_elf.h"
 #include "shared/source/device_binary_format/zebin_decoder.h"
 #include "shared/source/helpers/ptr_math.h"
+#include "shared/source/program/parallel_kernel_decoding.h"
 #include "shared/source/program/program_info.h"
 #include "shared/test/unit_test/device_binary_format/zebin_tests.h"
 #include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
@@ -117,6 +118,10 @@ TEST(ExtractZebinSections, GivenKnownSectionsThenCapturesThemProperly) {
     EXPECT_STREQ(NEO::Elf::SectionsNamesZebin::zeInfo.data(), strings + sections.zeInfoSections[0]->header->name);
     EXPECT_STREQ(NEO::Elf::SectionsNamesZebin::symtab.data(), strings + sections.symtabSections[0]->header->name);
     EXPECT_STREQ(NEO::Elf::SectionsNamesZebin::spv.data(), strings + sections.spirvSections[0]->header->name);
+
+    ASSERT_EQ(2U, sections.textKernelSectionsByKernelName.size());
+    EXPECT_EQ(sections.textKernelSections[0], sections.textKernelSectionsByKernelName["someKernel"]);
+    EXPECT_EQ(sections.textKernelSections[1], sections.textKernelSectionsByKernelName["someOtherKernel"]);
 }
 
 TEST(ExtractZebinSections, GivenMispelledConstDataSectionThenAllowItButEmitError) {
@@ -1624,6 +1629,85 @@ kernels:
     EXPECT_EQ(32, programInfo.kernelInfos[1]->kernelDescriptor.kernelAttributes.simdSize);
 }
 
+TEST(DecodeSingleDeviceBinaryZebin, GivenParallelKernelDecodingEnabledThenKernelDescriptorsArePopulatedInKernelsOrder) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableParallelKernelDecoding.set(1);
+    NEO::DebugManager.flags.ParallelKernelDecodingThreads.set(4);
+
+    constexpr uint32_t numKernels = 8 * NEO::ParallelKernelDecoding::minKernelsPerThread;
+    std::string zeInfo = "kernels:\n";
+    for (uint32_t i = 0; i < numKernels; i++) {
+        zeInfo += "    - name : kernel_" + std::to_string(i) + "\n";
+        zeInfo += "      execution_env :\n";
+        zeInfo += "        simd_size : " + std::string((i % 2) ? "16" : "32") + "\n";
+    }
+    ZebinTestData::ValidEmptyProgram zebin;
+    zebin.removeSection(NEO::Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, NEO::Elf::SectionsNamesZebin::zeInfo);
+    zebin.appendSection(NEO::Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, NEO::Elf::SectionsNamesZebin::zeInfo, ArrayRef<const uint8_t>::fromAny(zeInfo.data(), zeInfo.size()));
+    for (uint32_t i = 0; i < numKernels; i++) {
+        zebin.appendSection(NEO::Elf::SHT_PROGBITS, NEO::Elf::SectionsNamesZebin::textPrefix.str() + "kernel_" + std::to_string(i), {});
+    }
+
+    NEO::ProgramInfo programInfo;
+    NEO::SingleDeviceBinary singleBinary;
+    singleBinary.deviceBinary = zebin.storage;
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto error = NEO::decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Zebin>(programInfo, singleBinary, decodeErrors, decodeWarnings);
+    EXPECT_EQ(NEO::DecodeError::Success, error);
+    EXPECT_TRUE(decodeErrors.empty()) << decodeErrors;
+    EXPECT_TRUE(decodeWarnings.empty()) << decodeWarnings;
+
+    ASSERT_EQ(numKernels, programInfo.kernelInfos.size());
+    for (uint32_t i = 0; i < numKernels; i++) {
+        EXPECT_EQ("kernel_" + std::to_string(i), programInfo.kernelInfos[i]->kernelDescriptor.kernelMetadata.kernelName);
+        EXPECT_EQ((i % 2) ? 16 : 32, programInfo.kernelInfos[i]->kernelDescriptor.kernelAttributes.simdSize);
+    }
+}
+
+TEST(DecodeSingleDeviceBinaryZebin, GivenParallelKernelDecodingWhenKernelsFailToDecodeThenOnlyFirstErrorIsReported) {
+    NEO::ConstStringRef zeInfo = R"===(
+kernels:
+    - name : some_kernel
+      execution_env :
+        simd_size : 8
+    - name : some_other_kernel
+      execution_env :
+        simd_size : 7
+    - name : yet_another_kernel
+      execution_env :
+        simd_size : 5
+)===";
+    ZebinTestData::ValidEmptyProgram zebin;
+    zebin.removeSection(NEO::Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, NEO::Elf::SectionsNamesZebin::zeInfo);
+    zebin.appendSection(NEO::Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, NEO::Elf::SectionsNamesZebin::zeInfo, ArrayRef<const uint8_t>::fromAny(zeInfo.data(), zeInfo.size()));
+    zebin.appendSection(NEO::Elf::SHT_PROGBITS, NEO::Elf::SectionsNamesZebin::textPrefix.str() + "some_kernel", {});
+
+    std::string errors;
+    std::string warnings;
+    auto elf = NEO::Elf::decodeElf(zebin.storage, errors, warnings);
+    NEO::ZebinSections sections;
+    ASSERT_EQ(NEO::DecodeError::Success, NEO::extractZebinSections(elf, sections, errors, warnings));
+    auto zeInfoData = sections.zeInfoSections[0]->data;
+    NEO::Yaml::YamlParser parser;
+    ASSERT_TRUE(parser.parse(NEO::ConstStringRef(reinterpret_cast<const char *>(zeInfoData.begin()), zeInfoData.size()), errors, warnings));
+    std::vector<const NEO::Yaml::Node *> kernelNodes;
+    for (const auto &kernelNd : parser.createChildrenRange(*parser.findNodeWithKeyDfs("kernels"))) {
+        kernelNodes.push_back(&kernelNd);
+    }
+    ASSERT_EQ(3U, kernelNodes.size());
+
+    NEO::ProgramInfo programInfo;
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto error = NEO::populateKernelDescriptorsInParallel(programInfo, elf, sections, parser, kernelNodes, 3U, decodeErrors, decodeWarnings);
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, error);
+    EXPECT_TRUE(decodeWarnings.empty()) << decodeWarnings;
+    EXPECT_STREQ("DeviceBinaryFormat::Zebin : Invalid simd size : 7 in context of : some_other_kernel. Expected 1, 8, 16 or 32. Got : 7\n", decodeErrors.c_str());
+    ASSERT_EQ(1U, programInfo.kernelInfos.size());
+    EXPECT_STREQ("some_kernel", programInfo.kernelInfos[0]->kernelDescriptor.kernelMetadata.kernelName.c_str());
+}
+
 TEST(PopulateKernelDescriptor, WhenValidationOfZeinfoSectionsCountFailsThenDecodingFails) {
     NEO::ConstStringRef zeinfo = R"===(
 kernels:
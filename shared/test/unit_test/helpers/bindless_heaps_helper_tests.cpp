@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/bindless_heaps_helper.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/test/unit_test/helpers/default_hw_info.h"
+#include "shared/test/unit_test/mocks/mock_device.h"
+
+#include "opencl/test/unit_test/mocks/mock_execution_environment.h"
+#include "opencl/test/unit_test/mocks/mock_memory_manager.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+struct BindlessHeapsHelperTest : public ::testing::Test {
+    void SetUp() override {
+        executionEnvironment = std::make_unique<MockExecutionEnvironment>(defaultHwInfo.get());
+        memoryManager = std::make_unique<MockMemoryManager>(*executionEnvironment);
+        bindlessHeapsHelper = std::make_unique<BindlessHeapsHelper>(memoryManager.get(), 0u, 1u, surfaceStateSize);
+    }
+
+    static constexpr size_t surfaceStateSize = 64u;
+    std::unique_ptr<MockExecutionEnvironment> executionEnvironment;
+    std::unique_ptr<MockMemoryManager> memoryManager;
+    std::unique_ptr<BindlessHeapsHelper> bindlessHeapsHelper;
+};
+
+TEST_F(BindlessHeapsHelperTest, whenHelperIsCreatedThenGlobalSurfaceStateHeapIsAllocated) {
+    auto heapAllocation = bindlessHeapsHelper->getHeapAllocation();
+    ASSERT_NE(nullptr, heapAllocation);
+    EXPECT_EQ(GraphicsAllocation::AllocationType::SURFACE_STATE_HEAP, heapAllocation->getAllocationType());
+    EXPECT_EQ(heapAllocation->getGpuAddress(), bindlessHeapsHelper->getGlobalHeapGpuBase());
+    EXPECT_EQ(BindlessHeapsHelper::globalSshSize, bindlessHeapsHelper->getHeapSize());
+    EXPECT_EQ(0u, bindlessHeapsHelper->getUsedSlotsCount());
+}
+
+TEST_F(BindlessHeapsHelperTest, whenSurfaceStatesAreAllocatedThenConsecutiveSlotsAreReturned) {
+    auto first = bindlessHeapsHelper->allocateSSInHeap();
+    auto second = bindlessHeapsHelper->allocateSSInHeap();
+
+    EXPECT_EQ(0u, first.surfaceStateOffset);
+    EXPECT_EQ(surfaceStateSize, second.surfaceStateOffset);
+    EXPECT_EQ(ptrOffset(bindlessHeapsHelper->getHeapAllocation()->getUnderlyingBuffer(), second.surfaceStateOffset), second.ssPtr);
+    EXPECT_EQ(2u, bindlessHeapsHelper->getUsedSlotsCount());
+}
+
+TEST_F(BindlessHeapsHelperTest, givenReleasedSurfaceStateWhenAllocatingThenReleasedSlotIsReused) {
+    bindlessHeapsHelper->allocateSSInHeap();
+    auto released = bindlessHeapsHelper->allocateSSInHeap();
+    bindlessHeapsHelper->releaseSSInHeap(released.surfaceStateOffset);
+    EXPECT_EQ(1u, bindlessHeapsHelper->getUsedSlotsCount());
+
+    auto reused = bindlessHeapsHelper->allocateSSInHeap();
+    EXPECT_EQ(released.surfaceStateOffset, reused.surfaceStateOffset);
+    EXPECT_EQ(2u, bindlessHeapsHelper->getUsedSlotsCount());
+}
+
+TEST(BindlessHeapsHelperDeviceTest, givenHeapUsedBySubmissionInProgressWhenSurfaceStateIsReleasedThenSlotIsReusedOnlyAfterSubmissionCompletes) {
+    std::unique_ptr<MockDevice> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    auto bindlessHeapsHelper = std::make_unique<BindlessHeapsHelper>(device->getMemoryManager(), device->getRootDeviceIndex(),
+                                                                     device->getDeviceBitfield(), BindlessHeapsHelperTest::surfaceStateSize);
+    auto defaultEngine = device->getDefaultEngine();
+    auto tagAddress = defaultEngine.commandStreamReceiver->getTagAddress();
+    *tagAddress = 1;
+    bindlessHeapsHelper->getHeapAllocation()->updateTaskCount(2, defaultEngine.osContext->getContextId());
+
+    auto released = bindlessHeapsHelper->allocateSSInHeap();
+    bindlessHeapsHelper->releaseSSInHeap(released.surfaceStateOffset);
+
+    auto allocatedWhileBusy = bindlessHeapsHelper->allocateSSInHeap();
+    EXPECT_NE(released.surfaceStateOffset, allocatedWhileBusy.surfaceStateOffset);
+
+    *tagAddress = 2;
+    auto allocatedAfterCompletion = bindlessHeapsHelper->allocateSSInHeap();
+    EXPECT_EQ(released.surfaceStateOffset, allocatedAfterCompletion.surfaceStateOffset);
+}
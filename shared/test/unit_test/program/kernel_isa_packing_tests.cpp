@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/program/kernel_isa_packing.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+using namespace NEO::KernelIsaPacking;
+
+TEST(KernelIsaPackingTest, givenNoKernelsWhenPackingThenNoAllocationsAreRequired) {
+    std::vector<IsaPlacement> placements;
+    auto allocationSizes = packKernelsIsa({}, placements);
+    EXPECT_TRUE(allocationSizes.empty());
+    EXPECT_TRUE(placements.empty());
+}
+
+TEST(KernelIsaPackingTest, givenSmallKernelsWhenPackingThenAllKernelsAreAlignedInOneAllocationWithPrefetchPadding) {
+    std::vector<IsaPlacement> placements;
+    auto allocationSizes = packKernelsIsa({100, 64, 1, 200}, placements);
+
+    ASSERT_EQ(1u, allocationSizes.size());
+    ASSERT_EQ(4u, placements.size());
+    EXPECT_EQ(0u, placements[0].offset);
+    EXPECT_EQ(128u, placements[1].offset);
+    EXPECT_EQ(192u, placements[2].offset);
+    EXPECT_EQ(256u, placements[3].offset);
+    for (auto &placement : placements) {
+        EXPECT_EQ(0u, placement.allocationId);
+        EXPECT_EQ(0u, placement.offset % isaAlignment);
+    }
+    EXPECT_EQ(256u + 200u + prefetchPadding, allocationSizes[0]);
+}
+
+TEST(KernelIsaPackingTest, givenKernelsExceedingMaxPackedSizeWhenPackingThenNextAllocationIsStarted) {
+    std::vector<IsaPlacement> placements;
+    size_t halfSize = maxPackedAllocationSize / 2;
+    auto allocationSizes = packKernelsIsa({halfSize, halfSize, 64}, placements);
+
+    ASSERT_EQ(2u, allocationSizes.size());
+    EXPECT_EQ(0u, placements[0].allocationId);
+    EXPECT_EQ(0u, placements[0].offset);
+    EXPECT_EQ(1u, placements[1].allocationId);
+    EXPECT_EQ(0u, placements[1].offset);
+    EXPECT_EQ(1u, placements[2].allocationId);
+    EXPECT_EQ(halfSize, placements[2].offset);
+    EXPECT_EQ(halfSize + prefetchPadding, allocationSizes[0]);
+    EXPECT_EQ(halfSize + 64 + prefetchPadding, allocationSizes[1]);
+}
+
+TEST(KernelIsaPackingTest, givenKernelBiggerThanMaxPackedSizeWhenPackingThenItGetsOwnAllocation) {
+    std::vector<IsaPlacement> placements;
+    auto allocationSizes = packKernelsIsa({64, maxPackedAllocationSize * 2, 64}, placements);
+
+    ASSERT_EQ(3u, allocationSizes.size());
+    EXPECT_EQ(1u, placements[1].allocationId);
+    EXPECT_EQ(0u, placements[1].offset);
+    EXPECT_EQ(maxPackedAllocationSize * 2 + prefetchPadding, allocationSizes[1]);
+    EXPECT_EQ(2u, placements[2].allocationId);
+}
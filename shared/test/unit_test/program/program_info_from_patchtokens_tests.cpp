@@ -7,10 +7,12 @@
 
 #include "shared/source/compiler_interface/linker.h"
 #include "shared/source/device_binary_format/patchtokens_decoder.h"
+#include "shared/source/program/parallel_kernel_decoding.h"
 #include "shared/source/program/program_info.h"
 #include "shared/source/program/program_info_from_patchtokens.h"
 #include "shared/test/unit_test/compiler_interface/linker_mock.h"
 #include "shared/test/unit_test/device_binary_format/patchtokens_tests.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "opencl/source/program/kernel_info.h"
 
@@ -245,6 +247,46 @@ TEST(PopulateProgramInfoFromPatchtokensTests, GivenProgramWithKernelsWhenKernelH
     EXPECT_EQ(1U, receivedSegmentIds[1]);
 }
 
+TEST(PopulateProgramInfoFromPatchtokensTests, GivenParallelKernelDecodingEnabledThenKernelInfosAndLinkerInputArePopulatedInKernelsOrder) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableParallelKernelDecoding.set(1);
+    NEO::DebugManager.flags.ParallelKernelDecodingThreads.set(4);
+
+    NEO::ProgramInfo programInfo = {};
+    Mock<NEO::LinkerInput> *mockLinkerInput = new Mock<NEO::LinkerInput>;
+    programInfo.linkerInput.reset(mockLinkerInput);
+
+    vISA::GenSymEntry entry[1] = {};
+    iOpenCL::SPatchFunctionTableInfo symbolTable = {};
+    symbolTable.NumEntries = 1;
+    std::vector<uint8_t> symbolTableTokenStorage = {};
+    symbolTableTokenStorage.insert(symbolTableTokenStorage.end(),
+                                   reinterpret_cast<uint8_t *>(&symbolTable), reinterpret_cast<uint8_t *>(&symbolTable + 1));
+    symbolTableTokenStorage.insert(symbolTableTokenStorage.end(),
+                                   reinterpret_cast<uint8_t *>(entry), reinterpret_cast<uint8_t *>(entry + 1));
+
+    constexpr uint32_t numKernels = 8 * NEO::ParallelKernelDecoding::minKernelsPerThread;
+    PatchTokensTestData::ValidProgramWithKernel programFromTokens;
+    programFromTokens.kernels.resize(numKernels, programFromTokens.kernels[0]);
+    for (auto &kernel : programFromTokens.kernels) {
+        kernel.tokens.programSymbolTable = reinterpret_cast<iOpenCL::SPatchFunctionTableInfo *>(symbolTableTokenStorage.data());
+    }
+
+    std::vector<uint32_t> receivedSegmentIds;
+    mockLinkerInput->decodeExportedFunctionsSymbolTableMockConfig.overrideFunc = [&](Mock<NEO::LinkerInput> *, const void *data, uint32_t numEntries, uint32_t instructionsSegmentId) -> bool {
+        receivedSegmentIds.push_back(instructionsSegmentId);
+        return true;
+    };
+    NEO::populateProgramInfo(programInfo, programFromTokens);
+
+    ASSERT_EQ(numKernels, programInfo.kernelInfos.size());
+    ASSERT_EQ(numKernels, receivedSegmentIds.size());
+    for (uint32_t i = 0; i < numKernels; i++) {
+        EXPECT_EQ(i, receivedSegmentIds[i]);
+        EXPECT_EQ(programFromTokens.header->GPUPointerSizeInBytes, programInfo.kernelInfos[i]->gpuPointerSize);
+    }
+}
+
 TEST(PopulateProgramInfoFromPatchtokensTests, GivenProgramWithKernelsWhenKernelHasRelocationTableThenLinkerIsUpdatedWithAdditionalRelocationInfo) {
     NEO::ProgramInfo programInfo = {};
     Mock<NEO::LinkerInput> *mockLinkerInput = new Mock<NEO::LinkerInput>;
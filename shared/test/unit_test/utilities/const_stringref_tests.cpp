@@ -216,3 +216,12 @@ TEST(ConstStringStartsWith, GivenInvalidPrefixThenReturnsFalse) {
     EXPECT_FALSE(str.startsWith("some text "));
     EXPECT_FALSE(str.startsWith("substr some text"));
 }
+
+TEST(ConstStringRefHash, GivenEqualStringsThenReturnsSameHash) {
+    std::string str = "some text";
+    ConstStringRef ref1 = "some text";
+    ConstStringRef ref2 = str;
+    EXPECT_EQ(ConstStringRefHash{}(ref1), ConstStringRefHash{}(ref2));
+    EXPECT_NE(ConstStringRefHash{}(ref1), ConstStringRefHash{}(ConstStringRef("some texT")));
+    EXPECT_NE(ConstStringRefHash{}(ref1), ConstStringRefHash{}(ref1.substr(1)));
+}
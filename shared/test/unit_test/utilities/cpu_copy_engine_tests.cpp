@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/utilities/cpu_copy_engine.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace NEO;
+
+struct CpuCopyEngineTest : public ::testing::Test {
+    void SetUp() override {
+        src.resize(bufferSize + MemoryConstants::pageSize);
+        dst.resize(bufferSize + MemoryConstants::pageSize);
+        for (size_t i = 0; i < src.size(); i++) {
+            src[i] = static_cast<uint8_t>(i * 7 + i / 251);
+        }
+    }
+
+    void expectCopied(size_t dstOffset, size_t srcOffset, size_t size) {
+        EXPECT_EQ(0, memcmp(dst.data() + dstOffset, src.data() + srcOffset, size));
+        if (dstOffset > 0) {
+            EXPECT_EQ(0u, dst[dstOffset - 1]);
+        }
+        EXPECT_EQ(0u, dst[dstOffset + size]);
+    }
+
+    static constexpr size_t bufferSize = 4 * MemoryConstants::megaByte;
+    std::vector<uint8_t> src;
+    std::vector<uint8_t> dst;
+};
+
+TEST(CpuCopyEngineCreateTest, givenDefaultFlagsWhenCreatingCpuCopyEngineThenNullptrIsReturned) {
+    EXPECT_EQ(nullptr, CpuCopyEngine::create());
+}
+
+TEST(CpuCopyEngineCreateTest, givenParallelCpuCopyThreadsSetWhenCreatingCpuCopyEngineThenCallingThreadIsCountedAsOneOfThem) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableParallelCpuCopy.set(1);
+
+    DebugManager.flags.ParallelCpuCopyThreads.set(4);
+    auto cpuCopyEngine = CpuCopyEngine::create();
+    ASSERT_NE(nullptr, cpuCopyEngine);
+    EXPECT_EQ(3u, cpuCopyEngine->getNumWorkers());
+
+    DebugManager.flags.ParallelCpuCopyThreads.set(1);
+    cpuCopyEngine = CpuCopyEngine::create();
+    ASSERT_NE(nullptr, cpuCopyEngine);
+    EXPECT_EQ(0u, cpuCopyEngine->getNumWorkers());
+}
+
+TEST(CpuCopyEngineChunkTest, givenCopySizeWhenGettingChunkSizeThenChunkIsPageAlignedAndSplitsWorkBetweenThreads) {
+    CpuCopyEngine cpuCopyEngine(3, 0, 0);
+    EXPECT_EQ(CpuCopyEngine::chunkAlignment, cpuCopyEngine.getChunkSize(1));
+    EXPECT_EQ(CpuCopyEngine::chunkAlignment, cpuCopyEngine.getChunkSize(16 * CpuCopyEngine::chunkAlignment));
+    EXPECT_EQ(2 * CpuCopyEngine::chunkAlignment, cpuCopyEngine.getChunkSize(16 * CpuCopyEngine::chunkAlignment + 1));
+    EXPECT_EQ(MemoryConstants::megaByte / 16, cpuCopyEngine.getChunkSize(MemoryConstants::megaByte));
+}
+
+TEST_F(CpuCopyEngineTest, givenCopySmallerThanParallelThresholdWhenCopyingThenDataIsCopied) {
+    CpuCopyEngine cpuCopyEngine(3, MemoryConstants::megaByte, bufferSize);
+    cpuCopyEngine.copy(dst.data() + 3, src.data() + 5, 1000);
+    expectCopied(3, 5, 1000);
+}
+
+TEST_F(CpuCopyEngineTest, givenNoWorkersWhenCopyingLargeBufferThenDataIsCopied) {
+    CpuCopyEngine cpuCopyEngine(0, 0, bufferSize * 2);
+    cpuCopyEngine.copy(dst.data() + 1, src.data(), bufferSize);
+    expectCopied(1, 0, bufferSize);
+}
+
+TEST_F(CpuCopyEngineTest, givenUnalignedPointersWhenCopyingInParallelThenAllChunksAreCopied) {
+    CpuCopyEngine cpuCopyEngine(3, 0, bufferSize * 2);
+    cpuCopyEngine.copy(dst.data() + 17, src.data() + 3, bufferSize - 1);
+    expectCopied(17, 3, bufferSize - 1);
+}
+
+TEST_F(CpuCopyEngineTest, givenCopyAboveNonTemporalThresholdWhenCopyingInParallelThenDataIsCopied) {
+    CpuCopyEngine cpuCopyEngine(3, 0, MemoryConstants::megaByte);
+    cpuCopyEngine.copy(dst.data() + 9, src.data() + 1, bufferSize - 3);
+    expectCopied(9, 1, bufferSize - 3);
+}
+
+TEST_F(CpuCopyEngineTest, givenManyConsecutiveCopiesWhenCopyingInParallelThenEachCopyIsCompletedBeforeReturning) {
+    CpuCopyEngine cpuCopyEngine(3, 0, bufferSize * 2);
+    for (size_t i = 0; i < 64; i++) {
+        size_t size = MemoryConstants::pageSize * (i + 1) + i;
+        std::fill(dst.begin(), dst.end(), static_cast<uint8_t>(0));
+        cpuCopyEngine.copy(dst.data() + i, src.data() + 2 * i, size);
+        expectCopied(i, 2 * i, size);
+    }
+}
+
+TEST_F(CpuCopyEngineTest, givenVariousSizesAndOffsetsWhenCopyingNonTemporalThenDataIsCopied) {
+    for (size_t dstOffset = 0; dstOffset < 16; dstOffset++) {
+        for (size_t size : {0u, 1u, 15u, 16u, 17u, 31u, 33u, 4095u}) {
+            std::fill(dst.begin(), dst.end(), static_cast<uint8_t>(0));
+            CpuCopyEngine::copyNonTemporal(dst.data() + dstOffset, src.data() + 1, size);
+            expectCopied(dstOffset, 1, size);
+        }
+    }
+}
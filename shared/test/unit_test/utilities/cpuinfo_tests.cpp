@@ -72,6 +72,8 @@ TEST(CpuInfoTest, giveFunctionIsNotAvailableWhenFeatureIsNotSupportedThenMaskBit
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureHle));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureRtm));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512F));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512Bw));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureTsc));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureRdtscp));
@@ -108,6 +110,8 @@ TEST(CpuInfoTest, giveFunctionIsAvailableWhenFeatureIsNotSupportedThenMaskBitIsO
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureHle));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureRtm));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512F));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512Bw));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureTsc));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureRdtscp));
@@ -144,6 +148,8 @@ TEST(CpuInfoTest, whenFeatureIsSupportedThenMaskBitIsOn) {
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureHle));
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureRtm));
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
+    EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512F));
+    EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512Bw));
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureTsc));
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureRdtscp));
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/program/parallel_kernel_decoding.h"
+#include "shared/source/utilities/parallel_for.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+TEST(ParallelForTest, givenZeroTasksWhenParallelForIsCalledThenTaskIsNotCalled) {
+    uint32_t calls = 0;
+    parallelFor(0u, 4u, [&](size_t) { calls++; });
+    EXPECT_EQ(0u, calls);
+}
+
+TEST(ParallelForTest, givenSingleThreadWhenParallelForIsCalledThenTasksAreRunInOrderOnCallingThread) {
+    std::vector<size_t> order;
+    std::vector<std::thread::id> threadIds;
+    parallelFor(10u, 1u, [&](size_t i) {
+        order.push_back(i);
+        threadIds.push_back(std::this_thread::get_id());
+    });
+    ASSERT_EQ(10u, order.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        EXPECT_EQ(i, order[i]);
+        EXPECT_EQ(std::this_thread::get_id(), threadIds[i]);
+    }
+}
+
+TEST(ParallelForTest, givenManyThreadsWhenParallelForIsCalledThenEachTaskIsRunExactlyOnce) {
+    constexpr size_t tasksCount = 1000;
+    std::vector<std::atomic<uint32_t>> calls(tasksCount);
+    for (auto &count : calls) {
+        count = 0;
+    }
+    std::mutex threadIdsMutex;
+    std::set<std::thread::id> threadIds;
+    parallelFor(tasksCount, 4u, [&](size_t i) {
+        calls[i]++;
+        std::lock_guard<std::mutex> lock(threadIdsMutex);
+        threadIds.insert(std::this_thread::get_id());
+    });
+    for (auto &count : calls) {
+        EXPECT_EQ(1u, count);
+    }
+    EXPECT_LE(threadIds.size(), 4u);
+}
+
+TEST(ParallelKernelDecodingTest, givenDefaultSettingsWhenGettingThreadsCountThenSingleThreadIsUsed) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(1u, ParallelKernelDecoding::getThreadsCount(10000u));
+}
+
+TEST(ParallelKernelDecodingTest, givenParallelDecodingEnabledWhenGettingThreadsCountThenItIsLimitedByKernelsCountAndThreadsSetting) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableParallelKernelDecoding.set(1);
+    DebugManager.flags.ParallelKernelDecodingThreads.set(4);
+
+    EXPECT_EQ(1u, ParallelKernelDecoding::getThreadsCount(0u));
+    EXPECT_EQ(1u, ParallelKernelDecoding::getThreadsCount(ParallelKernelDecoding::minKernelsPerThread - 1));
+    EXPECT_EQ(2u, ParallelKernelDecoding::getThreadsCount(2 * ParallelKernelDecoding::minKernelsPerThread));
+    EXPECT_EQ(4u, ParallelKernelDecoding::getThreadsCount(10000u));
+
+    DebugManager.flags.ParallelKernelDecodingThreads.set(-1);
+    EXPECT_LE(ParallelKernelDecoding::getThreadsCount(10000u), ParallelKernelDecoding::defaultMaxThreads);
+    EXPECT_GE(ParallelKernelDecoding::getThreadsCount(10000u), 1u);
+}